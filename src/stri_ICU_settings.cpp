@@ -31,6 +31,8 @@
 
 
 #include "stri_stringi.h"
+#include "stri_container_regex.h"
+#include "stri_collator.h"
 
 
 #ifndef STRI_ICU_FOUND
@@ -96,3 +98,93 @@ SEXP stri_info()
     return vals;
     STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
 }
+
+
+/** Query or modify the state of the compiled regex pattern cache
+ *
+ * @param capacity NULL or a single nonnegative integer;
+ *     new maximal number of cached patterns, 0 disables caching
+ * @param clear single logical value; whether to remove all cached
+ *     patterns and reset the counters
+ * @return list with elements capacity, size, hits, misses
+ *     (the state after the modifications)
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri_regex_cache(SEXP capacity, SEXP clear)
+{
+    bool clear_val = stri__prepare_arg_logical_1_notNA(clear, "clear");
+    int capacity_val = -1;
+    if (!Rf_isNull(capacity)) {
+        capacity_val = stri__prepare_arg_integer_1_notNA(capacity, "capacity");
+        if (capacity_val < 0)
+            Rf_error(MSG__EXPECTED_NONNEGATIVE);  // error() allowed here
+    }
+
+    if (clear_val)
+        StriRegexPatternCache::clear();
+    if (capacity_val >= 0)
+        StriRegexPatternCache::setCapacity(capacity_val);
+
+    STRI__ERROR_HANDLER_BEGIN(0)
+    const R_len_t infosize = 4;
+    SEXP vals;
+
+    STRI__PROTECT(vals = Rf_allocVector(VECSXP, infosize));
+    SET_VECTOR_ELT(vals, 0, Rf_ScalarInteger(StriRegexPatternCache::getCapacity()));
+    SET_VECTOR_ELT(vals, 1, Rf_ScalarInteger(StriRegexPatternCache::getSize()));
+    SET_VECTOR_ELT(vals, 2, Rf_ScalarReal(StriRegexPatternCache::getHits()));
+    SET_VECTOR_ELT(vals, 3, Rf_ScalarReal(StriRegexPatternCache::getMisses()));
+
+    stri__set_names(vals, infosize, "capacity", "size", "hits", "misses");
+
+    STRI__UNPROTECT_ALL
+    return vals;
+    STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
+}
+
+
+/** Query or modify the state of the collator cache
+ *
+ * @param capacity NULL or a single nonnegative integer;
+ *     new maximal number of cached collators, 0 disables caching
+ * @param clear single logical value; whether to remove all cached
+ *     collators (and ASCII weight tables) and reset the counters
+ * @return list with elements capacity, size, hits, misses
+ *     (the state after the modifications)
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri_collator_cache(SEXP capacity, SEXP clear)
+{
+    bool clear_val = stri__prepare_arg_logical_1_notNA(clear, "clear");
+    int capacity_val = -1;
+    if (!Rf_isNull(capacity)) {
+        capacity_val = stri__prepare_arg_integer_1_notNA(capacity, "capacity");
+        if (capacity_val < 0)
+            Rf_error(MSG__EXPECTED_NONNEGATIVE);  // error() allowed here
+    }
+
+    if (clear_val) {
+        StriCollatorCache::clear();
+        StriCollatorASCII::clear();
+    }
+    if (capacity_val >= 0)
+        StriCollatorCache::setCapacity(capacity_val);
+
+    STRI__ERROR_HANDLER_BEGIN(0)
+    const R_len_t infosize = 4;
+    SEXP vals;
+
+    STRI__PROTECT(vals = Rf_allocVector(VECSXP, infosize));
+    SET_VECTOR_ELT(vals, 0, Rf_ScalarInteger(StriCollatorCache::getCapacity()));
+    SET_VECTOR_ELT(vals, 1, Rf_ScalarInteger(StriCollatorCache::getSize()));
+    SET_VECTOR_ELT(vals, 2, Rf_ScalarReal(StriCollatorCache::getHits()));
+    SET_VECTOR_ELT(vals, 3, Rf_ScalarReal(StriCollatorCache::getMisses()));
+
+    stri__set_names(vals, infosize, "capacity", "size", "hits", "misses");
+
+    STRI__UNPROTECT_ALL
+    return vals;
+    STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
+}
@@ -0,0 +1,247 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "stri_stringi.h"
+#include "stri_bytesearch_ahocorasick.h"
+#include <algorithm>
+#include <cstring>
+
+
+/** Byte-lexicographic ordering of pattern ids (ties: by id)
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+struct StriByteSearchAhoCorasickComparer {
+    const char** patternStr;
+    const R_len_t* patternLen;
+
+    StriByteSearchAhoCorasickComparer(const char** _patternStr, const R_len_t* _patternLen)
+        : patternStr(_patternStr), patternLen(_patternLen) { }
+
+    inline bool operator()(R_len_t a, R_len_t b) const {
+        R_len_t n = std::min(patternLen[a], patternLen[b]);
+        int ret = memcmp(patternStr[a], patternStr[b], (size_t)n);
+        if (ret != 0) return (ret < 0);
+        if (patternLen[a] != patternLen[b]) return (patternLen[a] < patternLen[b]);
+        return (a < b);
+    }
+};
+
+
+/** Build the automaton
+ *
+ * @param patternStr array of numPatterns UTF-8 strings (not NA, nonempty)
+ * @param patternLen their lengths in bytes
+ * @param numPatterns number of patterns
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+StriByteSearchAhoCorasick::StriByteSearchAhoCorasick(
+    const char** patternStr, const R_len_t* patternLen, R_len_t numPatterns)
+{
+    m_numPatterns = numPatterns;
+    m_searchStr = NULL;
+    m_searchLen = 0;
+    reset(NULL, 0);
+
+    std::vector<R_len_t> order(numPatterns);
+    for (R_len_t i=0; i<numPatterns; ++i) order[i] = i;
+    std::sort(order.begin(), order.end(),
+        StriByteSearchAhoCorasickComparer(patternStr, patternLen));
+
+    // BFS over the trie: node k represents the patterns order[lo[k]..hi[k]-1]
+    // (all sharing the same prefix of length m_depth[k])
+    std::vector<R_len_t> lo(1, 0);
+    std::vector<R_len_t> hi(1, numPatterns);
+    m_firstChild.push_back(1);
+    m_numChildren.push_back(0);
+    m_label.push_back(0);
+    m_depth.push_back(0);
+    m_pattern.push_back(-1);
+    std::vector<R_len_t> parent(1, 0);
+    m_samePattern.assign(numPatterns, -1);
+
+    for (R_len_t k=0; k<(R_len_t)lo.size(); ++k) {
+        R_len_t d = m_depth[k];
+        R_len_t a = lo[k];
+        R_len_t b = hi[k];
+
+        // patterns that end here come first in the sorted order
+        // (duplicates - by increasing ids)
+        while (a < b && patternLen[order[a]] == d) {
+            if (m_pattern[k] < 0)
+                m_pattern[k] = order[a];
+            else
+                m_samePattern[order[a-1]] = order[a];
+            ++a;
+        }
+
+        m_firstChild[k] = (R_len_t)lo.size();
+        while (a < b) {
+            unsigned char c = (unsigned char)patternStr[order[a]][d];
+            R_len_t e = a+1;
+            while (e < b && (unsigned char)patternStr[order[e]][d] == c) ++e;
+
+            lo.push_back(a);
+            hi.push_back(e);
+            m_firstChild.push_back(0);
+            m_numChildren.push_back(0);
+            m_label.push_back(c);
+            m_depth.push_back(d+1);
+            m_pattern.push_back(-1);
+            parent.push_back(k);
+            ++m_numChildren[k];
+
+            a = e;
+        }
+    }
+
+    R_len_t numNodes = (R_len_t)lo.size();
+
+    for (R_len_t c=0; c<256; ++c)
+        m_rootNext[c] = 0;
+    for (R_len_t j=0; j<m_numChildren[0]; ++j)
+        m_rootNext[m_label[m_firstChild[0]+j]] = m_firstChild[0]+j;
+
+    // failure links and the longest terminal suffixes, in the BFS order
+    m_fail.assign(numNodes, 0);
+    m_longest.assign(numNodes, -1);
+    for (R_len_t k=1; k<numNodes; ++k) {
+        if (parent[k] != 0)
+            m_fail[k] = next(m_fail[parent[k]], m_label[k]);
+        if (m_pattern[k] >= 0)
+            m_longest[k] = k;
+        else
+            m_longest[k] = m_longest[m_fail[k]];
+    }
+
+    m_seen.assign(numNodes, 0);
+}
+
+
+/** Find the next leftmost-longest match
+ *
+ * Matches are non-overlapping; the search resumes
+ * where the previous match ended.
+ *
+ * @return start of the match (byte index) or USEARCH_DONE
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+R_len_t StriByteSearchAhoCorasick::findNext()
+{
+    R_len_t state = 0;
+    R_len_t candStart = -1, candEnd = -1, candPattern = -1;
+
+    for (R_len_t j=m_searchPos; j<m_searchLen; ++j) {
+        state = next(state, (unsigned char)m_searchStr[j]);
+
+        R_len_t t = m_longest[state];
+        if (t >= 0) {
+            // the longest pattern ending here has the leftmost start
+            R_len_t s = j+1-m_depth[t];
+            if (candStart < 0 || s <= candStart) {
+                candStart = s;
+                candEnd = j+1;
+                candPattern = m_pattern[t];
+            }
+        }
+
+        // no future match can start at or before candStart
+        if (candStart >= 0 && j+1-m_depth[state] > candStart)
+            break;
+    }
+
+    if (candStart < 0) {
+        m_searchPos = m_searchLen;
+        m_matchStart = m_matchEnd = m_matchPattern = -1;
+        return USEARCH_DONE;
+    }
+
+    m_searchPos = m_matchEnd = candEnd;
+    m_matchStart = candStart;
+    m_matchPattern = candPattern;
+    return m_matchStart;
+}
+
+
+/** Check whether any of the patterns occurs in the search string
+ *
+ * @return true if there is at least one match
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+bool StriByteSearchAhoCorasick::detectAny()
+{
+    R_len_t state = 0;
+    for (R_len_t j=0; j<m_searchLen; ++j) {
+        state = next(state, (unsigned char)m_searchStr[j]);
+        if (m_longest[state] >= 0)
+            return true;
+    }
+    return false;
+}
+
+
+/** Determine all the patterns that occur in the search string
+ *  (overlapping matches included)
+ *
+ * @param found [out] ids of the matching patterns (in no particular order,
+ *    each one reported once)
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriByteSearchAhoCorasick::detectAll(std::vector<R_len_t>& found)
+{
+    found.clear();
+    std::vector<R_len_t> visited;
+    R_len_t state = 0;
+    for (R_len_t j=0; j<m_searchLen; ++j) {
+        state = next(state, (unsigned char)m_searchStr[j]);
+
+        // follow the chain of terminal suffixes; all the suffixes of
+        // an already visited node have been reported too
+        for (R_len_t t = m_longest[state]; t >= 0 && !m_seen[t];
+                t = m_longest[m_fail[t]]) {
+            m_seen[t] = 1;
+            visited.push_back(t);
+            for (R_len_t p = m_pattern[t]; p >= 0; p = m_samePattern[p])
+                found.push_back(p);
+        }
+
+        if ((R_len_t)found.size() == m_numPatterns)
+            break;
+    }
+
+    for (size_t i=0; i<visited.size(); ++i)
+        m_seen[visited[i]] = 0;
+}
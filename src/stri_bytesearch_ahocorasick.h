@@ -0,0 +1,150 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef __stri_bytesearch_ahocorasick_h
+#define __stri_bytesearch_ahocorasick_h
+
+
+#include "stri_stringi.h"
+#include "stri_bytesearch_matcher.h"
+#include <vector>
+
+
+/**
+ * Aho-Corasick automaton over the UTF-8 bytes of a set of fixed patterns;
+ * allows for finding the matches of all the patterns in a single pass
+ *
+ * Trie nodes are numbered in the BFS order so that the children of each
+ * node occupy a contiguous range of node ids and are sorted
+ * with respect to the labels of the incoming edges.
+ *
+ * Patterns are identified by their indices in the input vector; if a pattern
+ * is given more than once, findNext() reports the first index.
+ *
+ * @version 1.8.8 (2026-10-16)
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    detectAny(), detectAll()
+ */
+class StriByteSearchAhoCorasick {
+
+private:
+
+    StriByteSearchAhoCorasick(const StriByteSearchAhoCorasick&); /* no copy-able */
+    StriByteSearchAhoCorasick& operator=(const StriByteSearchAhoCorasick&);
+
+protected:
+
+    std::vector<R_len_t> m_firstChild;  ///< id of the first child
+    std::vector<R_len_t> m_numChildren; ///< number of children
+    std::vector<unsigned char> m_label; ///< label of the incoming edge
+    std::vector<R_len_t> m_depth;       ///< prefix length
+    std::vector<R_len_t> m_fail;        ///< failure link
+    std::vector<R_len_t> m_pattern;     ///< pattern id (if terminal) or -1
+    std::vector<R_len_t> m_longest;     ///< longest terminal suffix node or -1
+    std::vector<R_len_t> m_samePattern; ///< next id of an identical pattern or -1
+    std::vector<char> m_seen;           ///< used by detectAll()
+    R_len_t m_rootNext[256];            ///< full transition table for the root
+
+    R_len_t m_numPatterns;
+
+    const char* m_searchStr; // owned by caller
+    R_len_t m_searchLen;
+    R_len_t m_searchPos;     ///< where the next search begins
+    R_len_t m_matchStart;
+    R_len_t m_matchEnd;
+    R_len_t m_matchPattern;
+
+
+    /** transition function (via failure links)
+     *
+     * @param state current node
+     * @param c next byte
+     * @return next node
+     */
+    inline R_len_t next(R_len_t state, unsigned char c) const {
+        while (state != 0) {
+            R_len_t lo = m_firstChild[state];
+            R_len_t hi = lo+m_numChildren[state];
+            while (lo < hi) { // binary search, labels are sorted
+                R_len_t mid = lo+(hi-lo)/2;
+                if (m_label[mid] < c) lo = mid+1;
+                else hi = mid;
+            }
+            if (lo < m_firstChild[state]+m_numChildren[state] && m_label[lo] == c)
+                return lo;
+            state = m_fail[state];
+        }
+        return m_rootNext[c];
+    }
+
+
+public:
+
+    StriByteSearchAhoCorasick(const char** patternStr, const R_len_t* patternLen,
+        R_len_t numPatterns);
+
+    inline R_len_t getNumPatterns() const { return m_numPatterns; }
+
+    void reset(const char* searchStr, R_len_t searchLen) {
+        m_searchStr = searchStr;
+        m_searchLen = searchLen;
+        m_searchPos = 0;
+        m_matchStart = m_matchEnd = m_matchPattern = -1;
+    }
+
+    R_len_t findNext();
+
+    bool detectAny();
+
+    void detectAll(std::vector<R_len_t>& found);
+
+    /** get start index of the pattern match from the last search
+     *
+     * @return byte index in searchStr
+     */
+    inline R_len_t getMatchedStart() const { return m_matchStart; }
+
+    /** get length of the pattern match from the last search
+     *
+     * @return number of bytes
+     */
+    inline R_len_t getMatchedLength() const { return m_matchEnd-m_matchStart; }
+
+    /** get the id of the pattern matched in the last search
+     *
+     * @return pattern index
+     */
+    inline R_len_t getMatchedPattern() const { return m_matchPattern; }
+};
+
+#endif
@@ -35,12 +35,29 @@
 
 
 #include "stri_stringi.h"
+#include <cstring>
 
 #ifndef USEARCH_DONE
 #define USEARCH_DONE -1
 #endif
 
 
+// stri_bytesearch_simd.cpp:
+#define STRI_BYTESEARCH_SIMD_NONE 0
+#define STRI_BYTESEARCH_SIMD_SSE2 1
+#define STRI_BYTESEARCH_SIMD_AVX2 2
+
+int stri__bytesearch_simd_level();
+R_len_t stri__bytesearch_fwd(const char* str, R_len_t from, R_len_t len,
+    const char* pat, R_len_t patlen);
+R_len_t stri__bytesearch_back(const char* str, R_len_t len,
+    const char* pat, R_len_t patlen);
+R_len_t stri__bytesearch_fwd_ci(const char* str, R_len_t from, R_len_t len,
+    const char* pat_lc, R_len_t patlen);
+R_len_t stri__bytesearch_back_ci(const char* str, R_len_t len,
+    const char* pat_lc, R_len_t patlen);
+
+
 /**
  * Performs actual pattern matching on behalf of StriContainerByteSearch
  *
@@ -529,4 +546,254 @@ public:
 };
 
 
+/**
+ * Case-sensitive search for patterns of length >= 2 based on
+ * first+last byte filtering, which processes 16 (SSE2) or 32 (AVX2)
+ * candidate positions at a time; the instruction set is selected at runtime,
+ * see stri_bytesearch_simd.cpp (a portable memchr-based variant is
+ * used on other platforms)
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriByteSearchMatcherSIMD : public StriByteSearchMatcher {
+
+private:
+
+    StriByteSearchMatcherSIMD(const StriByteSearchMatcherSIMD&); /* no copy-able */
+    StriByteSearchMatcherSIMD& operator=(const StriByteSearchMatcherSIMD&);
+
+protected:
+
+    virtual R_len_t findFromPos(R_len_t startPos) {
+#ifndef NDEBUG
+        if (!m_searchStr) throw StriException("!m_searchStr");
+#endif
+
+        R_len_t res = stri__bytesearch_fwd(m_searchStr, startPos, m_searchLen,
+            m_patternStr, m_patternLen);
+        if (res != USEARCH_DONE) {
+            m_searchPos = res;
+            m_searchEnd = m_searchPos+m_patternLen;
+            return m_searchPos;
+        }
+        else {
+            m_searchPos = m_searchEnd = m_searchLen;
+            return USEARCH_DONE;
+        }
+    }
+
+
+public:
+
+    StriByteSearchMatcherSIMD(const char* patternStr, R_len_t patternLen, bool optOverlap)
+        : StriByteSearchMatcher(patternStr, patternLen, optOverlap)
+    {
+#ifndef NDEBUG
+        if (patternLen < 2) throw StriException("StriByteSearchMatcherSIMD");
+#endif
+    }
+
+    virtual R_len_t findFirst() {
+        return findFromPos(0);
+    }
+
+    virtual R_len_t findLast()  {
+        R_len_t res = stri__bytesearch_back(m_searchStr, m_searchLen,
+            m_patternStr, m_patternLen);
+        if (res != USEARCH_DONE) {
+            m_searchPos = res;
+            m_searchEnd = m_searchPos+m_patternLen;
+            return m_searchPos;
+        }
+        else {
+            m_searchPos = m_searchEnd = m_searchLen;
+            return USEARCH_DONE;
+        }
+    }
+};
+
+
+/**
+ * Case-sensitive search for long patterns via the Boyer-Moore-Horspool
+ * algorithm: the window is shifted according to the byte aligned with
+ * the pattern's last (forward search) or first (backward search) byte,
+ * which gives sublinear average behaviour; the shift tables
+ * have a fixed size (256 entries) and are set up lazily
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriByteSearchMatcherHorspool : public StriByteSearchMatcher {
+
+private:
+
+    StriByteSearchMatcherHorspool(const StriByteSearchMatcherHorspool&); /* no copy-able */
+    StriByteSearchMatcherHorspool& operator=(const StriByteSearchMatcherHorspool&);
+
+protected:
+
+    R_len_t m_shiftFwd[256];  // m_shiftFwd[0] < 0 if not set up yet
+    R_len_t m_shiftBack[256]; // m_shiftBack[0] < 0 if not set up yet
+
+    void setupShiftFwd() {
+        const unsigned char* pat = (const unsigned char*)m_patternStr;
+        for (R_len_t c=0; c<256; ++c)
+            m_shiftFwd[c] = m_patternLen;
+        for (R_len_t j=0; j<m_patternLen-1; ++j)
+            m_shiftFwd[pat[j]] = m_patternLen-1-j;
+    }
+
+    void setupShiftBack() {
+        const unsigned char* pat = (const unsigned char*)m_patternStr;
+        for (R_len_t c=0; c<256; ++c)
+            m_shiftBack[c] = m_patternLen;
+        for (R_len_t j=m_patternLen-1; j>=1; --j)
+            m_shiftBack[pat[j]] = j;
+    }
+
+    virtual R_len_t findFromPos(R_len_t startPos) {
+#ifndef NDEBUG
+        if (!m_searchStr) throw StriException("!m_searchStr");
+#endif
+        if (m_shiftFwd[0] < 0) setupShiftFwd();
+
+        const unsigned char* str = (const unsigned char*)m_searchStr;
+        const unsigned char last = (unsigned char)m_patternStr[m_patternLen-1];
+        R_len_t maxPos = m_searchLen-m_patternLen;
+        for (R_len_t i=startPos; i<=maxPos; ) {
+            unsigned char c = str[i+m_patternLen-1];
+            if (c == last && 0 == memcmp(str+i, m_patternStr, m_patternLen-1)) {
+                m_searchPos = i;
+                m_searchEnd = i+m_patternLen;
+                return m_searchPos;
+            }
+            i += m_shiftFwd[c];
+        }
+
+        // else not found
+        m_searchPos = m_searchEnd = m_searchLen;
+        return USEARCH_DONE;
+    }
+
+
+public:
+
+    StriByteSearchMatcherHorspool(const char* patternStr, R_len_t patternLen, bool optOverlap)
+        : StriByteSearchMatcher(patternStr, patternLen, optOverlap)
+    {
+#ifndef NDEBUG
+        if (patternLen < 2) throw StriException("StriByteSearchMatcherHorspool");
+#endif
+        m_shiftFwd[0] = -1;
+        m_shiftBack[0] = -1;
+    }
+
+    virtual R_len_t findFirst() {
+        return findFromPos(0);
+    }
+
+    virtual R_len_t findLast()  {
+        if (m_shiftBack[0] < 0) setupShiftBack();
+
+        const unsigned char* str = (const unsigned char*)m_searchStr;
+        const unsigned char first = (unsigned char)m_patternStr[0];
+        for (R_len_t i=m_searchLen-m_patternLen; i>=0; ) {
+            unsigned char c = str[i];
+            if (c == first && 0 == memcmp(str+i+1, m_patternStr+1, m_patternLen-1)) {
+                m_searchPos = i;
+                m_searchEnd = i+m_patternLen;
+                return m_searchPos;
+            }
+            i -= m_shiftBack[c];
+        }
+
+        // else not found
+        m_searchPos = m_searchEnd = m_searchLen;
+        return USEARCH_DONE;
+    }
+};
+
+
+/**
+ * Case-insensitive search for ASCII patterns in ASCII strings:
+ * a lowercased copy of the pattern is matched against the haystack
+ * folded on the fly (via a lookup table or vectorised OR-ing with 0x20),
+ * see stri_bytesearch_simd.cpp
+ *
+ * This gives the same results as StriByteSearchMatcherKMPci only if both
+ * the pattern and the haystack are ASCII (e.g., U+017F LATIN SMALL
+ * LETTER LONG S is upper-cased to an ASCII letter).
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriByteSearchMatcherASCIIci : public StriByteSearchMatcher {
+
+private:
+
+    StriByteSearchMatcherASCIIci(const StriByteSearchMatcherASCIIci&); /* no copy-able */
+    StriByteSearchMatcherASCIIci& operator=(const StriByteSearchMatcherASCIIci&);
+
+protected:
+
+    char* m_patternStrLower;
+
+    virtual R_len_t findFromPos(R_len_t startPos) {
+#ifndef NDEBUG
+        if (!m_searchStr) throw StriException("!m_searchStr");
+#endif
+
+        R_len_t res = stri__bytesearch_fwd_ci(m_searchStr, startPos, m_searchLen,
+            m_patternStrLower, m_patternLen);
+        if (res != USEARCH_DONE) {
+            m_searchPos = res;
+            m_searchEnd = m_searchPos+m_patternLen;
+            return m_searchPos;
+        }
+        else {
+            m_searchPos = m_searchEnd = m_searchLen;
+            return USEARCH_DONE;
+        }
+    }
+
+
+public:
+
+    virtual ~StriByteSearchMatcherASCIIci() {
+        delete [] m_patternStrLower;
+    }
+
+    StriByteSearchMatcherASCIIci(const char* patternStr, R_len_t patternLen, bool optOverlap)
+        : StriByteSearchMatcher(patternStr, patternLen, optOverlap)
+    {
+#ifndef NDEBUG
+        if (patternLen < 1) throw StriException("StriByteSearchMatcherASCIIci");
+#endif
+        this->m_patternStrLower = new char[patternLen+1];
+        if (!this->m_patternStrLower) throw StriException(MSG__MEM_ALLOC_ERROR);
+        for (R_len_t j=0; j<patternLen; ++j) {
+            char c = patternStr[j];
+            m_patternStrLower[j] = (c >= 'A' && c <= 'Z')?(char)(c+('a'-'A')):c;
+        }
+        m_patternStrLower[patternLen] = '\0';
+    }
+
+    virtual R_len_t findFirst() {
+        return findFromPos(0);
+    }
+
+    virtual R_len_t findLast()  {
+        R_len_t res = stri__bytesearch_back_ci(m_searchStr, m_searchLen,
+            m_patternStrLower, m_patternLen);
+        if (res != USEARCH_DONE) {
+            m_searchPos = res;
+            m_searchEnd = m_searchPos+m_patternLen;
+            return m_searchPos;
+        }
+        else {
+            m_searchPos = m_searchEnd = m_searchLen;
+            return USEARCH_DONE;
+        }
+    }
+};
+
+
 #endif
@@ -0,0 +1,584 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "stri_stringi.h"
+#include "stri_bytesearch_matcher.h"
+#include <cstring>
+
+#if !defined(STRI__BYTESEARCH_DISABLE_SIMD) && \
+    (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define STRI__BYTESEARCH_X86
+#include <immintrin.h>
+#endif
+
+
+/* Fixed pattern search via "first and last byte" filtering
+ * (W. Mula, SIMD-friendly algorithms for substring searching, 2016):
+ * for each block of consecutive candidate positions, we compare
+ * the first byte of the pattern against the haystack at once as well as
+ * its last byte against the haystack shifted by patternLen-1.
+ * Only the positions where both agree are verified with memcmp.
+ *
+ * Each function below returns the byte index of the first/last match
+ * or USEARCH_DONE. The haystacks are not required to be NUL-terminated.
+ */
+
+
+/** portable implementation - forward search
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static R_len_t stri__bytesearch_fwd_generic(const char* str, R_len_t from,
+    R_len_t len, const char* pat, R_len_t patlen)
+{
+    const char last = pat[patlen-1];
+    const char* cur = str+from;
+    const char* end = str+len-patlen+1; // one past the last candidate
+    while (cur < end) {
+        cur = (const char*)memchr(cur, (unsigned char)pat[0], end-cur);
+        if (!cur) break;
+        if (cur[patlen-1] == last && 0 == memcmp(cur+1, pat+1, patlen-2))
+            return (R_len_t)(cur-str);
+        ++cur;
+    }
+    return USEARCH_DONE;
+}
+
+
+/** portable implementation - backward search
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static R_len_t stri__bytesearch_back_generic(const char* str, R_len_t upto,
+    const char* pat, R_len_t patlen)
+{
+    // upto - one past the last candidate position
+    const char first = pat[0];
+    const char last = pat[patlen-1];
+    for (R_len_t i=upto-1; i>=0; --i) {
+        if (str[i] == first && str[i+patlen-1] == last &&
+                0 == memcmp(str+i+1, pat+1, patlen-2))
+            return i;
+    }
+    return USEARCH_DONE;
+}
+
+
+/* Case-insensitive search for ASCII patterns in ASCII haystacks:
+ * the pattern is given in lower case and each haystack byte is folded
+ * via a lookup table. In the SIMD variants, OR-ing a haystack byte
+ * with 0x20 is exact whenever the corresponding pattern byte
+ * is a lowercase letter (nothing is OR-ed otherwise), hence the
+ * first+last byte filter generates no false positives.
+ */
+
+
+/** ASCII lowercasing table; all the other bytes are left as-is */
+static const unsigned char stri__ascii_fold[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+    0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+
+
+/** compare n bytes of str (any case) with pat_lc (lower case)
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static inline bool stri__ascii_caseeq(const char* str, const char* pat_lc, R_len_t n)
+{
+    for (R_len_t j=0; j<n; ++j) {
+        if (stri__ascii_fold[(unsigned char)str[j]] != (unsigned char)pat_lc[j])
+            return false;
+    }
+    return true;
+}
+
+
+/** portable implementation - forward case-insensitive search
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static R_len_t stri__bytesearch_fwd_ci_generic(const char* str, R_len_t from,
+    R_len_t len, const char* pat_lc, R_len_t patlen)
+{
+    const unsigned char first = (unsigned char)pat_lc[0];
+    const unsigned char last = (unsigned char)pat_lc[patlen-1];
+    for (R_len_t i=from; i<=len-patlen; ++i) {
+        if (stri__ascii_fold[(unsigned char)str[i]] == first &&
+                stri__ascii_fold[(unsigned char)str[i+patlen-1]] == last &&
+                stri__ascii_caseeq(str+i+1, pat_lc+1, patlen-2))
+            return i;
+    }
+    return USEARCH_DONE;
+}
+
+
+/** portable implementation - backward case-insensitive search
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static R_len_t stri__bytesearch_back_ci_generic(const char* str, R_len_t upto,
+    const char* pat_lc, R_len_t patlen)
+{
+    // upto - one past the last candidate position
+    const unsigned char first = (unsigned char)pat_lc[0];
+    const unsigned char last = (unsigned char)pat_lc[patlen-1];
+    for (R_len_t i=upto-1; i>=0; --i) {
+        if (stri__ascii_fold[(unsigned char)str[i]] == first &&
+                stri__ascii_fold[(unsigned char)str[i+patlen-1]] == last &&
+                stri__ascii_caseeq(str+i+1, pat_lc+1, patlen-2))
+            return i;
+    }
+    return USEARCH_DONE;
+}
+
+
+#ifdef STRI__BYTESEARCH_X86
+
+/** SSE2 implementation - forward search
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+__attribute__((target("sse2")))
+static R_len_t stri__bytesearch_fwd_sse2(const char* str, R_len_t from,
+    R_len_t len, const char* pat, R_len_t patlen)
+{
+    const __m128i first = _mm_set1_epi8(pat[0]);
+    const __m128i last  = _mm_set1_epi8(pat[patlen-1]);
+
+    R_len_t i = from;
+    for (; i+patlen-1+16 <= len; i += 16) {
+        const __m128i block_first = _mm_loadu_si128((const __m128i*)(str+i));
+        const __m128i block_last  = _mm_loadu_si128((const __m128i*)(str+i+patlen-1));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(
+            _mm_cmpeq_epi8(first, block_first),
+            _mm_cmpeq_epi8(last, block_last)));
+        while (mask != 0) {
+            R_len_t k = i+__builtin_ctz(mask);
+            if (0 == memcmp(str+k+1, pat+1, patlen-2))
+                return k;
+            mask &= mask-1;
+        }
+    }
+
+    // the remaining (at most 15+patlen-1 bytes)
+    return stri__bytesearch_fwd_generic(str, i, len, pat, patlen);
+}
+
+
+/** SSE2 implementation - backward search
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+__attribute__((target("sse2")))
+static R_len_t stri__bytesearch_back_sse2(const char* str, R_len_t upto,
+    const char* pat, R_len_t patlen)
+{
+    const __m128i first = _mm_set1_epi8(pat[0]);
+    const __m128i last  = _mm_set1_epi8(pat[patlen-1]);
+
+    R_len_t i = upto;
+    for (; i >= 16; i -= 16) {
+        R_len_t b = i-16;
+        const __m128i block_first = _mm_loadu_si128((const __m128i*)(str+b));
+        const __m128i block_last  = _mm_loadu_si128((const __m128i*)(str+b+patlen-1));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(
+            _mm_cmpeq_epi8(first, block_first),
+            _mm_cmpeq_epi8(last, block_last)));
+        while (mask != 0) {
+            int bit = 31-__builtin_clz(mask);
+            R_len_t k = b+bit;
+            if (0 == memcmp(str+k+1, pat+1, patlen-2))
+                return k;
+            mask &= ~(1u<<bit);
+        }
+    }
+
+    return stri__bytesearch_back_generic(str, i, pat, patlen);
+}
+
+
+/** AVX2 implementation - forward search
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+__attribute__((target("avx2")))
+static R_len_t stri__bytesearch_fwd_avx2(const char* str, R_len_t from,
+    R_len_t len, const char* pat, R_len_t patlen)
+{
+    const __m256i first = _mm256_set1_epi8(pat[0]);
+    const __m256i last  = _mm256_set1_epi8(pat[patlen-1]);
+
+    R_len_t i = from;
+    for (; i+patlen-1+32 <= len; i += 32) {
+        const __m256i block_first = _mm256_loadu_si256((const __m256i*)(str+i));
+        const __m256i block_last  = _mm256_loadu_si256((const __m256i*)(str+i+patlen-1));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(first, block_first),
+            _mm256_cmpeq_epi8(last, block_last)));
+        while (mask != 0) {
+            R_len_t k = i+__builtin_ctz(mask);
+            if (0 == memcmp(str+k+1, pat+1, patlen-2))
+                return k;
+            mask &= mask-1;
+        }
+    }
+
+    return stri__bytesearch_fwd_sse2(str, i, len, pat, patlen);
+}
+
+
+/** AVX2 implementation - backward search
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+__attribute__((target("avx2")))
+static R_len_t stri__bytesearch_back_avx2(const char* str, R_len_t upto,
+    const char* pat, R_len_t patlen)
+{
+    const __m256i first = _mm256_set1_epi8(pat[0]);
+    const __m256i last  = _mm256_set1_epi8(pat[patlen-1]);
+
+    R_len_t i = upto;
+    for (; i >= 32; i -= 32) {
+        R_len_t b = i-32;
+        const __m256i block_first = _mm256_loadu_si256((const __m256i*)(str+b));
+        const __m256i block_last  = _mm256_loadu_si256((const __m256i*)(str+b+patlen-1));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(first, block_first),
+            _mm256_cmpeq_epi8(last, block_last)));
+        while (mask != 0) {
+            int bit = 31-__builtin_clz(mask);
+            R_len_t k = b+bit;
+            if (0 == memcmp(str+k+1, pat+1, patlen-2))
+                return k;
+            mask &= ~(1u<<bit);
+        }
+    }
+
+    return stri__bytesearch_back_sse2(str, i, pat, patlen);
+}
+
+
+/** SSE2 implementation - forward case-insensitive search
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+__attribute__((target("sse2")))
+static R_len_t stri__bytesearch_fwd_ci_sse2(const char* str, R_len_t from,
+    R_len_t len, const char* pat_lc, R_len_t patlen)
+{
+    const __m128i first = _mm_set1_epi8(pat_lc[0]);
+    const __m128i last  = _mm_set1_epi8(pat_lc[patlen-1]);
+    const __m128i case_first = _mm_set1_epi8(
+        (pat_lc[0] >= 'a' && pat_lc[0] <= 'z')?0x20:0x00);
+    const __m128i case_last  = _mm_set1_epi8(
+        (pat_lc[patlen-1] >= 'a' && pat_lc[patlen-1] <= 'z')?0x20:0x00);
+
+    R_len_t i = from;
+    for (; i+patlen-1+16 <= len; i += 16) {
+        const __m128i block_first = _mm_or_si128(case_first,
+            _mm_loadu_si128((const __m128i*)(str+i)));
+        const __m128i block_last  = _mm_or_si128(case_last,
+            _mm_loadu_si128((const __m128i*)(str+i+patlen-1)));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(
+            _mm_cmpeq_epi8(first, block_first),
+            _mm_cmpeq_epi8(last, block_last)));
+        while (mask != 0) {
+            R_len_t k = i+__builtin_ctz(mask);
+            if (stri__ascii_caseeq(str+k+1, pat_lc+1, patlen-2))
+                return k;
+            mask &= mask-1;
+        }
+    }
+
+    return stri__bytesearch_fwd_ci_generic(str, i, len, pat_lc, patlen);
+}
+
+
+/** SSE2 implementation - backward case-insensitive search
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+__attribute__((target("sse2")))
+static R_len_t stri__bytesearch_back_ci_sse2(const char* str, R_len_t upto,
+    const char* pat_lc, R_len_t patlen)
+{
+    const __m128i first = _mm_set1_epi8(pat_lc[0]);
+    const __m128i last  = _mm_set1_epi8(pat_lc[patlen-1]);
+    const __m128i case_first = _mm_set1_epi8(
+        (pat_lc[0] >= 'a' && pat_lc[0] <= 'z')?0x20:0x00);
+    const __m128i case_last  = _mm_set1_epi8(
+        (pat_lc[patlen-1] >= 'a' && pat_lc[patlen-1] <= 'z')?0x20:0x00);
+
+    R_len_t i = upto;
+    for (; i >= 16; i -= 16) {
+        R_len_t b = i-16;
+        const __m128i block_first = _mm_or_si128(case_first,
+            _mm_loadu_si128((const __m128i*)(str+b)));
+        const __m128i block_last  = _mm_or_si128(case_last,
+            _mm_loadu_si128((const __m128i*)(str+b+patlen-1)));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(
+            _mm_cmpeq_epi8(first, block_first),
+            _mm_cmpeq_epi8(last, block_last)));
+        while (mask != 0) {
+            int bit = 31-__builtin_clz(mask);
+            R_len_t k = b+bit;
+            if (stri__ascii_caseeq(str+k+1, pat_lc+1, patlen-2))
+                return k;
+            mask &= ~(1u<<bit);
+        }
+    }
+
+    return stri__bytesearch_back_ci_generic(str, i, pat_lc, patlen);
+}
+
+
+/** AVX2 implementation - forward case-insensitive search
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+__attribute__((target("avx2")))
+static R_len_t stri__bytesearch_fwd_ci_avx2(const char* str, R_len_t from,
+    R_len_t len, const char* pat_lc, R_len_t patlen)
+{
+    const __m256i first = _mm256_set1_epi8(pat_lc[0]);
+    const __m256i last  = _mm256_set1_epi8(pat_lc[patlen-1]);
+    const __m256i case_first = _mm256_set1_epi8(
+        (pat_lc[0] >= 'a' && pat_lc[0] <= 'z')?0x20:0x00);
+    const __m256i case_last  = _mm256_set1_epi8(
+        (pat_lc[patlen-1] >= 'a' && pat_lc[patlen-1] <= 'z')?0x20:0x00);
+
+    R_len_t i = from;
+    for (; i+patlen-1+32 <= len; i += 32) {
+        const __m256i block_first = _mm256_or_si256(case_first,
+            _mm256_loadu_si256((const __m256i*)(str+i)));
+        const __m256i block_last  = _mm256_or_si256(case_last,
+            _mm256_loadu_si256((const __m256i*)(str+i+patlen-1)));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(first, block_first),
+            _mm256_cmpeq_epi8(last, block_last)));
+        while (mask != 0) {
+            R_len_t k = i+__builtin_ctz(mask);
+            if (stri__ascii_caseeq(str+k+1, pat_lc+1, patlen-2))
+                return k;
+            mask &= mask-1;
+        }
+    }
+
+    return stri__bytesearch_fwd_ci_sse2(str, i, len, pat_lc, patlen);
+}
+
+
+/** AVX2 implementation - backward case-insensitive search
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+__attribute__((target("avx2")))
+static R_len_t stri__bytesearch_back_ci_avx2(const char* str, R_len_t upto,
+    const char* pat_lc, R_len_t patlen)
+{
+    const __m256i first = _mm256_set1_epi8(pat_lc[0]);
+    const __m256i last  = _mm256_set1_epi8(pat_lc[patlen-1]);
+    const __m256i case_first = _mm256_set1_epi8(
+        (pat_lc[0] >= 'a' && pat_lc[0] <= 'z')?0x20:0x00);
+    const __m256i case_last  = _mm256_set1_epi8(
+        (pat_lc[patlen-1] >= 'a' && pat_lc[patlen-1] <= 'z')?0x20:0x00);
+
+    R_len_t i = upto;
+    for (; i >= 32; i -= 32) {
+        R_len_t b = i-32;
+        const __m256i block_first = _mm256_or_si256(case_first,
+            _mm256_loadu_si256((const __m256i*)(str+b)));
+        const __m256i block_last  = _mm256_or_si256(case_last,
+            _mm256_loadu_si256((const __m256i*)(str+b+patlen-1)));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(first, block_first),
+            _mm256_cmpeq_epi8(last, block_last)));
+        while (mask != 0) {
+            int bit = 31-__builtin_clz(mask);
+            R_len_t k = b+bit;
+            if (stri__ascii_caseeq(str+k+1, pat_lc+1, patlen-2))
+                return k;
+            mask &= ~(1u<<bit);
+        }
+    }
+
+    return stri__bytesearch_back_ci_sse2(str, i, pat_lc, patlen);
+}
+
+#endif
+
+
+typedef R_len_t (*stri__bytesearch_fwd_t)(const char*, R_len_t, R_len_t, const char*, R_len_t);
+typedef R_len_t (*stri__bytesearch_back_t)(const char*, R_len_t, const char*, R_len_t);
+
+static int stri__bytesearch_simd_level_cached = -1;
+static stri__bytesearch_fwd_t  stri__bytesearch_fwd_impl  = stri__bytesearch_fwd_generic;
+static stri__bytesearch_back_t stri__bytesearch_back_impl = stri__bytesearch_back_generic;
+static stri__bytesearch_fwd_t  stri__bytesearch_fwd_ci_impl  = stri__bytesearch_fwd_ci_generic;
+static stri__bytesearch_back_t stri__bytesearch_back_ci_impl = stri__bytesearch_back_ci_generic;
+
+
+/** Determine (once) which instruction set is available on the current CPU
+ *  and select the corresponding search routines
+ *
+ * @return STRI_BYTESEARCH_SIMD_NONE, STRI_BYTESEARCH_SIMD_SSE2,
+ *    or STRI_BYTESEARCH_SIMD_AVX2
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+int stri__bytesearch_simd_level()
+{
+    if (stri__bytesearch_simd_level_cached >= 0)
+        return stri__bytesearch_simd_level_cached;
+
+    int level = STRI_BYTESEARCH_SIMD_NONE;
+#ifdef STRI__BYTESEARCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        level = STRI_BYTESEARCH_SIMD_AVX2;
+        stri__bytesearch_fwd_impl  = stri__bytesearch_fwd_avx2;
+        stri__bytesearch_back_impl = stri__bytesearch_back_avx2;
+        stri__bytesearch_fwd_ci_impl  = stri__bytesearch_fwd_ci_avx2;
+        stri__bytesearch_back_ci_impl = stri__bytesearch_back_ci_avx2;
+    }
+    else if (__builtin_cpu_supports("sse2")) {
+        level = STRI_BYTESEARCH_SIMD_SSE2;
+        stri__bytesearch_fwd_impl  = stri__bytesearch_fwd_sse2;
+        stri__bytesearch_back_impl = stri__bytesearch_back_sse2;
+        stri__bytesearch_fwd_ci_impl  = stri__bytesearch_fwd_ci_sse2;
+        stri__bytesearch_back_ci_impl = stri__bytesearch_back_ci_sse2;
+    }
+#endif
+
+    stri__bytesearch_simd_level_cached = level;
+    return level;
+}
+
+
+/** Find the first occurrence of a pattern (patlen >= 2)
+ *  in str[from..len-1]
+ *
+ * @param str haystack
+ * @param from start byte index
+ * @param len haystack length in bytes
+ * @param pat pattern
+ * @param patlen pattern length in bytes, >= 2
+ * @return byte index or USEARCH_DONE
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+R_len_t stri__bytesearch_fwd(const char* str, R_len_t from, R_len_t len,
+    const char* pat, R_len_t patlen)
+{
+    if (from < 0) from = 0;
+    if (patlen > len-from) return USEARCH_DONE;
+    if (stri__bytesearch_simd_level_cached < 0) stri__bytesearch_simd_level();
+    return stri__bytesearch_fwd_impl(str, from, len, pat, patlen);
+}
+
+
+/** Find the last occurrence of a pattern (patlen >= 2) in str[0..len-1]
+ *
+ * @param str haystack
+ * @param len haystack length in bytes
+ * @param pat pattern
+ * @param patlen pattern length in bytes, >= 2
+ * @return byte index or USEARCH_DONE
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+R_len_t stri__bytesearch_back(const char* str, R_len_t len,
+    const char* pat, R_len_t patlen)
+{
+    if (patlen > len) return USEARCH_DONE;
+    if (stri__bytesearch_simd_level_cached < 0) stri__bytesearch_simd_level();
+    return stri__bytesearch_back_impl(str, len-patlen+1, pat, patlen);
+}
+
+
+/** Find the first case-insensitive occurrence of an ASCII pattern
+ *  in an ASCII string str[from..len-1]
+ *
+ * @param str haystack
+ * @param from start byte index
+ * @param len haystack length in bytes
+ * @param pat_lc pattern in lower case
+ * @param patlen pattern length in bytes, >= 1
+ * @return byte index or USEARCH_DONE
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+R_len_t stri__bytesearch_fwd_ci(const char* str, R_len_t from, R_len_t len,
+    const char* pat_lc, R_len_t patlen)
+{
+    if (from < 0) from = 0;
+    if (patlen > len-from) return USEARCH_DONE;
+    if (stri__bytesearch_simd_level_cached < 0) stri__bytesearch_simd_level();
+    return stri__bytesearch_fwd_ci_impl(str, from, len, pat_lc, patlen);
+}
+
+
+/** Find the last case-insensitive occurrence of an ASCII pattern
+ *  in an ASCII string str[0..len-1]
+ *
+ * @param str haystack
+ * @param len haystack length in bytes
+ * @param pat_lc pattern in lower case
+ * @param patlen pattern length in bytes, >= 1
+ * @return byte index or USEARCH_DONE
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+R_len_t stri__bytesearch_back_ci(const char* str, R_len_t len,
+    const char* pat_lc, R_len_t patlen)
+{
+    if (patlen > len) return USEARCH_DONE;
+    if (stri__bytesearch_simd_level_cached < 0) stri__bytesearch_simd_level();
+    return stri__bytesearch_back_ci_impl(str, len-patlen+1, pat_lc, patlen);
+}
@@ -31,8 +31,12 @@
 
 
 #include "stri_stringi.h"
+#include "stri_collator.h"
 #include <unicode/ucol.h>
+#include <unicode/ucoleitr.h>
+#include <unicode/uset.h>
 #include <unicode/usearch.h>
+#include <algorithm>
 
 
 /**
@@ -68,6 +72,9 @@
  *
  * @version 1.8.1 (Marek Gagolewski, 2023-11-07)
  *    #476: Warn when falling back to the root locale, make C==en_US_POSIX
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    return clones of collators kept in StriCollatorCache
  */
 UCollator* stri__ucol_open(SEXP opts_collator)
 {
@@ -78,17 +85,6 @@ UCollator* stri__ucol_open(SEXP opts_collator)
 
     const char* default_locale = stri__prepare_arg_locale(R_NilValue, "locale");
 
-    if (narg <= 0) { // no custom settings - use default Collator
-        UErrorCode status = U_ZERO_ERROR;
-        UCollator* col = ucol_open(default_locale, &status);
-        STRI__CHECKICUSTATUS_RFERROR(status, {/* do nothing special on err */}) // error() allowed here
-        return col;
-    }
-
-    SEXP names = PROTECT(Rf_getAttrib(opts_collator, R_NamesSymbol));
-    if (names == R_NilValue || LENGTH(names) != narg)
-        Rf_error(MSG__INCORRECT_COLLATOR_OPTION_SPEC); // error() allowed here
-
     /* First, let's fetch collator's options --
     this process may call Rf_error, so we cannot do uloc_open yet (memleaks!) */
     UColAttributeValue  opt_FRENCH_COLLATION = UCOL_DEFAULT;
@@ -101,6 +97,14 @@ UCollator* stri__ucol_open(SEXP opts_collator)
 //   USearchAttributeValue  opt_OVERLAP = USEARCH_OFF;
     const char*         opt_LOCALE = default_locale;
 
+    SEXP names = R_NilValue;
+    if (narg > 0) {
+        names = Rf_getAttrib(opts_collator, R_NamesSymbol);
+        if (names == R_NilValue || LENGTH(names) != narg)
+            Rf_error(MSG__INCORRECT_COLLATOR_OPTION_SPEC); // error() allowed here
+    }
+    PROTECT(names);
+
     for (R_len_t i=0; i<narg; ++i) {
         if (STRING_ELT(names, i) == NA_STRING)
             Rf_error(MSG__INCORRECT_COLLATOR_OPTION_SPEC); // error() allowed here
@@ -149,8 +153,35 @@ UCollator* stri__ucol_open(SEXP opts_collator)
     }
     UNPROTECT(1); /* names */
 
-    // create collator
+    // try the cache first (no C++ objects here, Rf_error may be called);
+    // the attributes go first and the locale name last; if the latter
+    // is too long to fit in the key, the cache is not used at all
+    // (a truncated key could match another configuration)
+    char key[256];
+    int key_len = snprintf(key, sizeof(key), "%d|%d|%d|%d|%d|%d|%d|%s",
+        (int)opt_FRENCH_COLLATION, (int)opt_ALTERNATE_HANDLING,
+        (int)opt_CASE_FIRST, (int)opt_CASE_LEVEL, (int)opt_NORMALIZATION_MODE,
+        (int)opt_STRENGTH, (int)opt_NUMERIC_COLLATION,
+        opt_LOCALE?opt_LOCALE:"");
+    bool use_cache = (key_len >= 0 && key_len < (int)sizeof(key));
+
+    bool default_warning = false;
+    const UCollator* cached = (use_cache)?StriCollatorCache::get(key, default_warning):NULL;
     UErrorCode status = U_ZERO_ERROR;
+    if (cached) {
+        if (narg > 0 && default_warning)
+            Rf_warning("%s", ICUError::getICUerrorName(U_USING_DEFAULT_WARNING));
+#if U_ICU_VERSION_MAJOR_NUM >= 71
+        UCollator* col = ucol_clone(cached, &status);
+#else
+        UCollator* col = ucol_safeClone(cached, NULL, NULL, &status);
+#endif
+        STRI__CHECKICUSTATUS_RFERROR(status, { if (col) ucol_close(col); }) // error() allowed here
+        if (!col) Rf_error(MSG__MEM_ALLOC_ERROR); // error() allowed here
+        return col;
+    }
+
+    // create collator
     UCollator* col = ucol_open(opt_LOCALE, &status);
     STRI__CHECKICUSTATUS_RFERROR(status, { /* nothing special on err */ }) // error() allowed here
 
@@ -158,8 +189,11 @@ UCollator* stri__ucol_open(SEXP opts_collator)
         UErrorCode status2 = U_ZERO_ERROR;
         const char* valid_locale = ucol_getLocaleByType(col, ULOC_VALID_LOCALE, &status2);
         if (valid_locale && !strcmp(valid_locale, "root"))
-            Rf_warning("%s", ICUError::getICUerrorName(status));
+            default_warning = true;
     }
+
+    if (narg > 0 && default_warning)
+        Rf_warning("%s", ICUError::getICUerrorName(status));
     // else if (status == U_USING_FALLBACK_WARNING)  // warning on this would be too invasive
     //    Rf_warning("%s", ICUError::getICUerrorName(status));
 
@@ -213,5 +247,387 @@ UCollator* stri__ucol_open(SEXP opts_collator)
         STRI__CHECKICUSTATUS_RFERROR(status, { ucol_close(col); }) // error() allowed here
     }
 
+    if (use_cache)
+        StriCollatorCache::insert(key, col, default_warning);
+
     return col;
 }
+
+
+/** Create a copy of a collator, e.g., for use in another thread
+ *
+ * @param col collator
+ * @return a Collator object that should be closed with ucol_close() after use
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+UCollator* stri__ucol_clone(const UCollator* col)
+{
+    UErrorCode status = U_ZERO_ERROR;
+#if U_ICU_VERSION_MAJOR_NUM >= 71
+    UCollator* clone = ucol_clone(col, &status);
+#else
+    UCollator* clone = ucol_safeClone(col, NULL, NULL, &status);
+#endif
+    STRI__CHECKICUSTATUS_THROW(status, { if (clone) ucol_close(clone); })
+    if (!clone) throw StriException(MSG__MEM_ALLOC_ERROR);
+    return clone;
+}
+
+
+StriCollatorCache::List StriCollatorCache::lru;
+std::map<std::string, StriCollatorCache::List::iterator> StriCollatorCache::index;
+R_len_t StriCollatorCache::capacity = 16;
+double StriCollatorCache::hits = 0.0;
+double StriCollatorCache::misses = 0.0;
+
+
+/** Find a cached collator
+ *
+ * @param key see stri__ucol_open()
+ * @param default_warning [out] whether the collator fell back to
+ *    the root locale when it was created
+ * @return a collator owned by the cache (to be cloned, not closed;
+ *    valid until the next call to any other method) or NULL if not found
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+const UCollator* StriCollatorCache::get(const char* key, bool& default_warning)
+{
+    std::map<std::string, List::iterator>::iterator it = index.find(key);
+    if (it == index.end()) {
+        misses += 1.0;
+        return NULL;
+    }
+
+    hits += 1.0;
+    StriCollatorCacheEntry* entry = *(it->second);
+    lru.splice(lru.begin(), lru, it->second);  // now most recently used
+    default_warning = entry->default_warning;
+    return entry->col;
+}
+
+
+/** Store a copy of a collator
+ *
+ * Does nothing if caching is disabled or on failure.
+ *
+ * @param key see stri__ucol_open()
+ * @param col collator (not owned)
+ * @param default_warning whether the collator fell back to the root locale
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriCollatorCache::insert(const char* key, const UCollator* col,
+    bool default_warning)
+{
+    if (capacity <= 0 || index.find(key) != index.end())
+        return;
+
+    UErrorCode status = U_ZERO_ERROR;
+#if U_ICU_VERSION_MAJOR_NUM >= 71
+    UCollator* clone = ucol_clone(col, &status);
+#else
+    UCollator* clone = ucol_safeClone(col, NULL, NULL, &status);
+#endif
+    if (U_FAILURE(status) || !clone) {
+        if (clone) ucol_close(clone);
+        return;
+    }
+
+    evict(capacity-1);
+    StriCollatorCacheEntry* entry = new StriCollatorCacheEntry;
+    entry->key = key;
+    entry->col = clone;
+    entry->default_warning = default_warning;
+    lru.push_front(entry);
+    index[key] = lru.begin();
+}
+
+
+/** Remove least recently used entries until at most max_size remain
+ *
+ * @param max_size number of entries to keep
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriCollatorCache::evict(R_len_t max_size)
+{
+    if (max_size < 0) max_size = 0;
+    while ((R_len_t)lru.size() > max_size) {
+        StriCollatorCacheEntry* entry = lru.back();
+        lru.pop_back();
+        index.erase(entry->key);
+        ucol_close(entry->col);
+        delete entry;
+    }
+}
+
+
+/** Set the maximal number of cached collators; 0 disables caching
+ *
+ * @param new_capacity non-negative integer
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriCollatorCache::setCapacity(R_len_t new_capacity)
+{
+    if (new_capacity < 0) new_capacity = 0;
+    capacity = new_capacity;
+    evict(capacity);
+}
+
+
+/** Remove all cached collators and reset the hit/miss counters
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriCollatorCache::clear()
+{
+    evict(0);
+    hits = 0.0;
+    misses = 0.0;
+}
+
+
+std::map<std::string, StriCollatorASCII*> StriCollatorASCII::cache;
+
+
+/** Get the ASCII weight tables for a collator
+ *
+ * The tables are computed once per tailoring and strength
+ * and then cached. To be called from the main thread only.
+ *
+ * @param col collator
+ * @return tables owned by the cache (valid until the next call
+ *    to get() or clear()) or NULL if the collator's settings or tailoring
+ *    do not permit the use of this class
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+const StriCollatorASCII* StriCollatorASCII::get(const UCollator* col)
+{
+    if (!col) return NULL;
+
+    UErrorCode status = U_ZERO_ERROR;
+    UColAttributeValue strength = ucol_getAttribute(col, UCOL_STRENGTH, &status);
+    if (strength != UCOL_PRIMARY && strength != UCOL_SECONDARY &&
+            strength != UCOL_TERTIARY && strength != UCOL_IDENTICAL)
+        return NULL;
+    if (ucol_getAttribute(col, UCOL_FRENCH_COLLATION, &status) != UCOL_OFF ||
+            ucol_getAttribute(col, UCOL_ALTERNATE_HANDLING, &status) != UCOL_NON_IGNORABLE ||
+            ucol_getAttribute(col, UCOL_CASE_FIRST, &status) != UCOL_OFF ||
+            ucol_getAttribute(col, UCOL_CASE_LEVEL, &status) != UCOL_OFF ||
+            ucol_getAttribute(col, UCOL_NUMERIC_COLLATION, &status) != UCOL_OFF)
+        return NULL;
+    if (U_FAILURE(status))
+        return NULL;
+
+    if (ucol_getReorderCodes(col, NULL, 0, &status) != 0 || U_FAILURE(status))
+        return NULL;  // (sets U_BUFFER_OVERFLOW_ERROR if there are any)
+
+    const char* locale = ucol_getLocaleByType(col, ULOC_ACTUAL_LOCALE, &status);
+    if (!locale || U_FAILURE(status))
+        return NULL;
+
+    std::string key(locale);
+    key.push_back('|');
+    key.push_back('0'+(char)strength);
+
+    std::map<std::string, StriCollatorASCII*>::iterator it = cache.find(key);
+    if (it != cache.end())
+        return it->second;
+
+    if ((R_len_t)cache.size() >= MAX_CACHED)
+        clear();
+
+    StriCollatorASCII* ret = create(col);
+    cache[key] = ret;
+    return ret;
+}
+
+
+/** Free all the cached tables
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriCollatorASCII::clear()
+{
+    for (std::map<std::string, StriCollatorASCII*>::iterator it = cache.begin();
+            it != cache.end(); ++it) {
+        if (it->second) delete it->second;
+    }
+    cache.clear();
+}
+
+
+/** Compute the ASCII weight tables for a collator
+ *
+ * @param col collator, see get() for the attributes already checked
+ * @return a new object or NULL if not applicable
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+StriCollatorASCII* StriCollatorASCII::create(const UCollator* col)
+{
+    UErrorCode status = U_ZERO_ERROR;
+
+    // the root collation has no contractions consisting of ASCII
+    // characters only, but a tailoring may define some, e.g., "ch" in Czech
+    const char* locale = ucol_getLocaleByType(col, ULOC_ACTUAL_LOCALE, &status);
+    if (!locale || U_FAILURE(status))
+        return NULL;
+    if (strcmp(locale, "root") != 0) {
+        USet* tailored = ucol_getTailoredSet(col, &status);
+        if (U_FAILURE(status)) {
+            if (tailored) uset_close(tailored);
+            return NULL;
+        }
+        bool contractions = false;
+        int32_t nitems = uset_getItemCount(tailored);
+        UChar buf[16];
+        for (int32_t i=0; !contractions && i<nitems; ++i) {
+            UChar32 start, end;
+            status = U_ZERO_ERROR;
+            int32_t len = uset_getItem(tailored, i, &start, &end, buf, 16, &status);
+            if (status == U_BUFFER_OVERFLOW_ERROR)
+                continue;  // a long string, not ASCII-only anyway
+            if (len <= 0) continue;  // a range of code points
+            contractions = true;
+            for (int32_t j=0; contractions && j<len; ++j)
+                if (buf[j] >= 128) contractions = false;
+        }
+        uset_close(tailored);
+        if (contractions) return NULL;
+    }
+
+    // collation elements of single characters;
+    // 0x00 cannot occur in R strings
+    uint32_t weight[3][128];
+    for (int c=0; c<128; ++c)
+        weight[0][c] = weight[1][c] = weight[2][c] = 0;
+    for (int c=1; c<128; ++c) {
+        UChar uc = (UChar)c;
+        status = U_ZERO_ERROR;
+        UCollationElements* iter = ucol_openElements(col, &uc, 1, &status);
+        if (U_FAILURE(status)) {
+            if (iter) ucol_closeElements(iter);
+            return NULL;
+        }
+        R_len_t nce = 0;
+        int32_t ce;
+        while ((ce = ucol_next(iter, &status)) != UCOL_NULLORDER && U_SUCCESS(status)) {
+            if (ce == 0) continue;  // completely ignorable
+            // a second element would denote an expansion or
+            // a continuation (a long primary or a non-common lower weight byte)
+            if (++nce > 1) break;
+            weight[0][c] = ucol_primaryOrder(ce);
+            weight[1][c] = ucol_secondaryOrder(ce);
+            weight[2][c] = ucol_tertiaryOrder(ce)&0x3f;  // without the case bits
+        }
+        ucol_closeElements(iter);
+        if (U_FAILURE(status) || nce > 1)
+            return NULL;
+    }
+
+    StriCollatorASCII* ret = new StriCollatorASCII();
+    for (int l=0; l<3; ++l) {
+        // replace the weights with their ranks
+        std::vector<uint32_t> distinct(weight[l], weight[l]+128);
+        std::sort(distinct.begin(), distinct.end());
+        distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+        for (int c=0; c<128; ++c) {
+            if (weight[l][c] == 0)
+                ret->m_weight[l][c] = 0;
+            else
+                ret->m_weight[l][c] = (uint8_t)(1+(std::lower_bound(
+                    distinct.begin(), distinct.end(), weight[l][c])-distinct.begin()));
+                // distinct[0] == 0, hence the ranks are 2, 3, ...
+        }
+    }
+
+    UColAttributeValue strength = ucol_getAttribute(col, UCOL_STRENGTH, &status);
+    ret->m_levels = (strength == UCOL_PRIMARY)?1:((strength == UCOL_SECONDARY)?2:3);
+    ret->m_identical = (strength == UCOL_IDENTICAL);
+    return ret;
+}
+
+
+/** Compare two ASCII strings
+ *
+ * @param s1 ASCII string
+ * @param n1 its length
+ * @param s2 ASCII string
+ * @param n2 its length
+ * @return -1, 0, or 1, like ucol_strcollUTF8()
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+int StriCollatorASCII::compare(const char* s1, R_len_t n1,
+    const char* s2, R_len_t n2) const
+{
+    for (int l=0; l<m_levels; ++l) {
+        const uint8_t* w = m_weight[l];
+        R_len_t i = 0, j = 0;
+        while (true) {
+            while (i < n1 && !w[(uint8_t)s1[i]]) ++i;
+            while (j < n2 && !w[(uint8_t)s2[j]]) ++j;
+            if (i >= n1 || j >= n2) {
+                if (i < n1) return 1;
+                if (j < n2) return -1;
+                break;  // equal at this level
+            }
+            uint8_t w1 = w[(uint8_t)s1[i++]];
+            uint8_t w2 = w[(uint8_t)s2[j++]];
+            if (w1 != w2) return (w1 < w2)?-1:1;
+        }
+    }
+
+    if (m_identical) {
+        int ret = memcmp(s1, s2, (n1 < n2)?n1:n2);
+        if (ret != 0) return (ret < 0)?-1:1;
+        return (n1 < n2)?-1:((n1 > n2)?1:0);
+    }
+
+    return 0;
+}
+
+
+/** Generate a sort key of an ASCII string
+ *
+ * The keys are not compatible with ICU's ones, but they compare (via
+ * memcmp, a proper prefix being smaller) like the corresponding strings
+ * do. The key contains no zero bytes; it is not NUL-terminated.
+ *
+ * @param s ASCII string
+ * @param n its length
+ * @param out [out] the key is written at out[off]; out is resized accordingly
+ * @param off offset in out
+ * @return key length in bytes
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+size_t StriCollatorASCII::sortkey(const char* s, R_len_t n,
+    std::vector<uint8_t>& out, size_t off) const
+{
+    out.resize(off+(size_t)(m_levels+1)*(n+1));
+    uint8_t* k = out.data()+off;
+    size_t len = 0;
+    for (int l=0; l<m_levels; ++l) {
+        if (l > 0) k[len++] = 0x01;  // level separator
+        const uint8_t* w = m_weight[l];
+        for (R_len_t i=0; i<n; ++i) {
+            uint8_t b = w[(uint8_t)s[i]];
+            if (b) k[len++] = b;
+        }
+    }
+
+    if (m_identical) {
+        k[len++] = 0x01;
+        memcpy(k+len, s, n);
+        len += n;
+    }
+
+    out.resize(off+len);
+    return len;
+}
@@ -0,0 +1,156 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+#ifndef __stri_collator_h
+#define __stri_collator_h
+
+#include "stri_stringi.h"
+#include <unicode/ucol.h>
+#include <vector>
+#include <string>
+#include <list>
+#include <map>
+
+
+/** An entry in the collator cache, see StriCollatorCache
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+struct StriCollatorCacheEntry {
+    std::string key;        ///< locale and attribute values
+    UCollator* col;         ///< owned
+    bool default_warning;   ///< whether ucol_open fell back to the root locale
+};
+
+
+/**
+ * A process-wide, bounded LRU cache of configured collators
+ *
+ * Collators are keyed by the locale name and the values of all
+ * the attributes set by stri__ucol_open(). Each user gets a clone
+ * of a cached collator (cloning is much cheaper than opening
+ * and configuring a new one), which it closes with ucol_close() as usual.
+ *
+ * All the methods are to be called from the main thread only.
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriCollatorCache {
+
+private:
+
+    typedef std::list<StriCollatorCacheEntry*> List;
+
+    static List lru;  ///< most recently used first
+    static std::map<std::string, List::iterator> index;
+    static R_len_t capacity;
+    static double hits;
+    static double misses;
+
+    static void evict(R_len_t max_size);
+
+public:
+
+    static const UCollator* get(const char* key, bool& default_warning);
+    static void insert(const char* key, const UCollator* col,
+        bool default_warning);
+
+    static R_len_t getCapacity() { return capacity; }
+    static R_len_t getSize() { return (R_len_t)lru.size(); }
+    static double getHits() { return hits; }
+    static double getMisses() { return misses; }
+
+    static void setCapacity(R_len_t new_capacity);
+    static void clear();
+};
+
+
+/** StriCollatorASCII is only used for vectors at least this long
+ *  (computing the weight tables for the first time takes a while) */
+#define STRI__COLLATOR_ASCII_MIN_LENGTH 32
+
+
+/**
+ * Collation of ASCII strings via precomputed weight tables
+ *
+ * If a collator's settings and tailoring permit (each ASCII character
+ * maps to a single collation element, there are no contractions
+ * consisting of ASCII characters only, the strength is at most tertiary
+ * or identical, and the attributes that change how the weights
+ * are compared, such as alternate_shifted, numeric, french,
+ * case_level, uppercase_first, or script reordering, are not in use),
+ * comparing two ASCII strings reduces to comparing the sequences
+ * of their characters' primary, then secondary, and then tertiary
+ * weights (skipping zero, i.e., ignorable, ones), possibly followed
+ * by a bytewise comparison at the identical level.
+ * This is the case for the root locale (and all the locales that do not
+ * tailor it, e.g., English) with the default settings.
+ *
+ * The weights are replaced by their ranks among the ASCII characters
+ * (2..129, so that they fit in one byte), which also makes it possible
+ * to generate (ICU-incompatible, but equivalent) sort keys much faster.
+ *
+ * The results are always identical to those of ucol_strcollUTF8().
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriCollatorASCII {
+
+private:
+
+    enum { MAX_CACHED = 64 };
+
+    static std::map<std::string, StriCollatorASCII*> cache; ///< NULL: not applicable
+
+    uint8_t m_weight[3][128]; ///< ranks of the weights at each level; 0 == ignorable
+    int m_levels;             ///< 1, 2, or 3
+    bool m_identical;         ///< compare bytewise if equal at all the levels
+
+    StriCollatorASCII() { }
+    StriCollatorASCII(const StriCollatorASCII&); // no copy
+    StriCollatorASCII& operator=(const StriCollatorASCII&);
+
+    static StriCollatorASCII* create(const UCollator* col);
+
+public:
+
+    static const StriCollatorASCII* get(const UCollator* col);
+    static void clear();
+
+    int compare(const char* s1, R_len_t n1, const char* s2, R_len_t n2) const;
+    size_t sortkey(const char* s, R_len_t n,
+        std::vector<uint8_t>& out, size_t off) const;
+};
+
+#endif
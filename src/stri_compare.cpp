@@ -33,6 +33,7 @@
 #include "stri_stringi.h"
 #include "stri_container_utf8.h"
 #include "stri_container_utf16.h"
+#include "stri_sortkey.h"
 #include <unicode/ucol.h>
 #include <vector>
 #include <deque>
@@ -191,6 +192,145 @@ SEXP stri_cmp_neq(SEXP e1, SEXP e2) {
    ************************************************************************* */
 
 
+/**
+ * Generate sort keys of the distinct strings in two character vectors
+ * that are to be compared elementwise [internal]
+ *
+ * Comparing a pair of strings via ucol_strcollUTF8() is several times
+ * faster than generating a sort key; the keys only pay off if they
+ * are reused many times, e.g., if a short vector is recycled or
+ * if there are many repeated strings (like in \code{x \%s<\% "m"}
+ * with \code{x} being a long vector of names).
+ * Thanks to R's global string cache, identical strings are usually
+ * represented by the same CHARSXP, which makes them easy to detect.
+ *
+ * The vectors are scanned first; the keys are generated only if
+ * the number of distinct CHARSXPs is sufficiently small relative to
+ * \code{vectorize_length}. The scan is abandoned early otherwise,
+ * so that the case of (almost) all strings being distinct
+ * is not penalised.
+ *
+ * @param col collator
+ * @param e1 character vector
+ * @param e2 character vector
+ * @param vectorize_length result length
+ * @param e1_cont e1 in UTF-8
+ * @param e2_cont e2 in UTF-8
+ * @param id1 [out] the key ids of the elements in e1, -1 for NAs
+ * @param id2 [out] the key ids of the elements in e2, -1 for NAs
+ * @param keys [out] sort keys
+ *
+ * @return whether the keys have been generated
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static bool stri__cmp_sortkeys_prepare(UCollator* col,
+    SEXP e1, SEXP e2, R_len_t vectorize_length,
+    StriContainerUTF8& e1_cont, StriContainerUTF8& e2_cont,
+    std::vector<R_len_t>& id1, std::vector<R_len_t>& id2,
+    StriSortKeys& keys)
+{
+    if (vectorize_length < STRI__SORTKEY_MIN_LENGTH)
+        return false;
+
+    R_len_t n1 = LENGTH(e1);
+    R_len_t n2 = LENGTH(e2);
+    R_len_t max_distinct = vectorize_length/STRI__SORTKEY_REUSE_MIN;
+
+    // open addressing, linear probing; CHARSXP -> key id
+    std::vector<SEXP> slots(1024, (SEXP)NULL);
+    std::vector<R_len_t> slot_ids(1024, -1);
+    size_t mask = slots.size()-1;
+    R_len_t ndistinct = 0;
+    R_len_t nprocessed = 0;
+
+    id1.resize(n1);
+    id2.resize(n2);
+    for (int k=0; k<2; ++k) {
+        SEXP e = (k == 0)?e1:e2;
+        R_len_t n = (k == 0)?n1:n2;
+        R_len_t* id = (k == 0)?id1.data():id2.data();
+        for (R_len_t j=0; j<n; ++j, ++nprocessed) {
+            SEXP cur = STRING_ELT(e, j);
+            if (cur == NA_STRING) {
+                id[j] = -1;
+                continue;
+            }
+
+            uint64_t h = (uint64_t)(uintptr_t)cur*0x9e3779b97f4a7c15ULL;
+            size_t s = (size_t)(h>>32)&mask;
+            while (slots[s] != NULL && slots[s] != cur)
+                s = (s+1)&mask;
+
+            if (slots[s] == NULL) {
+                // a new string; give up as soon as it is clear that
+                // the keys will not be reused sufficiently many times
+                // (the latter condition detects the case of all strings
+                // being distinct early)
+                if (ndistinct >= max_distinct ||
+                        ndistinct > nprocessed/2+8*STRI__SORTKEY_MIN_LENGTH)
+                    return false;
+
+                slots[s] = cur;
+                slot_ids[s] = ndistinct;
+                id[j] = ndistinct++;
+
+                if (2*(size_t)ndistinct > slots.size()) {
+                    // rehash
+                    std::vector<SEXP> new_slots(2*slots.size(), (SEXP)NULL);
+                    std::vector<R_len_t> new_ids(2*slots.size(), -1);
+                    mask = new_slots.size()-1;
+                    for (size_t t=0; t<slots.size(); ++t) {
+                        if (slots[t] == NULL) continue;
+                        h = (uint64_t)(uintptr_t)slots[t]*0x9e3779b97f4a7c15ULL;
+                        s = (size_t)(h>>32)&mask;
+                        while (new_slots[s] != NULL) s = (s+1)&mask;
+                        new_slots[s] = slots[t];
+                        new_ids[s] = slot_ids[t];
+                    }
+                    slots.swap(new_slots);
+                    slot_ids.swap(new_ids);
+                }
+                continue;
+            }
+
+            id[j] = slot_ids[s];
+        }
+    }
+
+    // the ids have been assigned in the order of first occurrence
+    keys.reserve(ndistinct, 0);
+    for (R_len_t j=0; j<n1; ++j)
+        if (id1[j] == keys.size())
+            keys.push_back(col, e1_cont.get(j));
+    for (R_len_t j=0; j<n2; ++j)
+        if (id2[j] == keys.size())
+            keys.push_back(col, e2_cont.get(j));
+
+    return true;
+}
+
+
+/**
+ * Are all the non-missing strings in a character vector ASCII? [internal]
+ *
+ * @param cont strings in UTF-8
+ * @param n the number of strings to check (no recycling)
+ *
+ * @return bool
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static bool stri__cmp_all_ascii(StriContainerUTF8& cont, R_len_t n)
+{
+    for (R_len_t j=0; j<n; ++j) {
+        if (!cont.isNA(j) && !cont.get(j).isASCII())
+            return false;
+    }
+    return true;
+}
+
+
 /**
  * Compare elements in 2 character vectors, with collation [INTERNAL]
  *
@@ -210,6 +350,12 @@ SEXP stri_cmp_neq(SEXP e1, SEXP e2) {
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    reuse the sort keys of repeated strings (e.g., of a recycled
+ *    operand) via stri__cmp_sortkeys_prepare();
+ *    compare ASCII strings via StriCollatorASCII if possible
+ *    (if both vectors are ASCII-only)
  */
 SEXP stri__cmp_logical(SEXP e1, SEXP e2, SEXP opts_collator, int _type, int _negate)
 {
@@ -237,27 +383,65 @@ SEXP stri__cmp_logical(SEXP e1, SEXP e2, SEXP opts_collator, int _type, int _neg
     STRI__PROTECT(ret = Rf_allocVector(LGLSXP, vectorize_length));
     int* ret_tab = LOGICAL(ret);
 
-    for (R_len_t i = 0; i < vectorize_length; ++i)
-    {
-        if (e1_cont.isNA(i) || e2_cont.isNA(i)) {
-            ret_tab[i] = NA_LOGICAL;
-            continue;
+    // if all the strings are ASCII, they can be compared via the collator's
+    // weight tables (about as fast as comparing sort keys); otherwise,
+    // reusing the sort keys of repeated strings may pay off
+    const StriCollatorASCII* ascii = NULL;
+    if (vectorize_length >= STRI__COLLATOR_ASCII_MIN_LENGTH &&
+            stri__cmp_all_ascii(e1_cont, LENGTH(e1)) &&
+            stri__cmp_all_ascii(e2_cont, LENGTH(e2)))
+        ascii = StriCollatorASCII::get(col);
+
+    std::vector<R_len_t> id1, id2;
+    StriSortKeys keys;
+    if (!ascii && stri__cmp_sortkeys_prepare(col, e1, e2, vectorize_length,
+            e1_cont, e2_cont, id1, id2, keys)) {
+        R_len_t n1 = LENGTH(e1);
+        R_len_t n2 = LENGTH(e2);
+        for (R_len_t i = 0; i < vectorize_length; ++i)
+        {
+            R_len_t k1 = id1[i%n1];
+            R_len_t k2 = id2[i%n2];
+            if (k1 < 0 || k2 < 0) {
+                ret_tab[i] = NA_LOGICAL;
+                continue;
+            }
+
+            int cmp = keys.compare(k1, k2);
+            ret_tab[i] = (_type == ((cmp < 0)?-1:((cmp > 0)?1:0)));
+
+            if (_negate)
+                ret_tab[i] = !ret_tab[i];
+        }
+    }
+    else {
+        for (R_len_t i = 0; i < vectorize_length; ++i)
+        {
+            if (e1_cont.isNA(i) || e2_cont.isNA(i)) {
+                ret_tab[i] = NA_LOGICAL;
+                continue;
+            }
+
+            R_len_t     cur1_n = e1_cont.get(i).length();
+            const char* cur1_s = e1_cont.get(i).c_str();
+            R_len_t     cur2_n = e2_cont.get(i).length();
+            const char* cur2_s = e2_cont.get(i).c_str();
+
+            // with collation
+            if (ascii) {  // all the strings are ASCII
+                ret_tab[i] = (_type == ascii->compare(cur1_s, cur1_n, cur2_s, cur2_n));
+            }
+            else {
+                UErrorCode status = U_ZERO_ERROR;
+                ret_tab[i] = (_type == (int)ucol_strcollUTF8(col,
+                              cur1_s, cur1_n, cur2_s, cur2_n, &status
+                                                            ));
+                STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+            }
+
+            if (_negate)
+                ret_tab[i] = !ret_tab[i];
         }
-
-        R_len_t     cur1_n = e1_cont.get(i).length();
-        const char* cur1_s = e1_cont.get(i).c_str();
-        R_len_t     cur2_n = e2_cont.get(i).length();
-        const char* cur2_s = e2_cont.get(i).c_str();
-
-        // with collation
-        UErrorCode status = U_ZERO_ERROR;
-        ret_tab[i] = (_type == (int)ucol_strcollUTF8(col,
-                      cur1_s, cur1_n, cur2_s, cur2_n, &status
-                                                    ));
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-
-        if (_negate)
-            ret_tab[i] = !ret_tab[i];
     }
 
     if (col) {
@@ -411,6 +595,12 @@ SEXP stri_cmp_ge(SEXP e1, SEXP e2, SEXP opts_collator) {
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    reuse the sort keys of repeated strings (e.g., of a recycled
+ *    operand) via stri__cmp_sortkeys_prepare();
+ *    compare ASCII strings via StriCollatorASCII if possible
+ *    (if both vectors are ASCII-only)
  */
 SEXP stri_cmp(SEXP e1, SEXP e2, SEXP opts_collator)
 {
@@ -434,24 +624,59 @@ SEXP stri_cmp(SEXP e1, SEXP e2, SEXP opts_collator)
     STRI__PROTECT(ret = Rf_allocVector(INTSXP, vectorize_length));
     int* ret_int = INTEGER(ret);
 
-    for (R_len_t i = 0; i < vectorize_length; ++i)
-    {
-        if (e1_cont.isNA(i) || e2_cont.isNA(i)) {
-            ret_int[i] = NA_INTEGER;
-            continue;
+    // if all the strings are ASCII, they can be compared via the collator's
+    // weight tables (about as fast as comparing sort keys); otherwise,
+    // reusing the sort keys of repeated strings may pay off
+    const StriCollatorASCII* ascii = NULL;
+    if (vectorize_length >= STRI__COLLATOR_ASCII_MIN_LENGTH &&
+            stri__cmp_all_ascii(e1_cont, LENGTH(e1)) &&
+            stri__cmp_all_ascii(e2_cont, LENGTH(e2)))
+        ascii = StriCollatorASCII::get(col);
+
+    std::vector<R_len_t> id1, id2;
+    StriSortKeys keys;
+    if (!ascii && stri__cmp_sortkeys_prepare(col, e1, e2, vectorize_length,
+            e1_cont, e2_cont, id1, id2, keys)) {
+        R_len_t n1 = LENGTH(e1);
+        R_len_t n2 = LENGTH(e2);
+        for (R_len_t i = 0; i < vectorize_length; ++i)
+        {
+            R_len_t k1 = id1[i%n1];
+            R_len_t k2 = id2[i%n2];
+            if (k1 < 0 || k2 < 0) {
+                ret_int[i] = NA_INTEGER;
+                continue;
+            }
+
+            int cmp = keys.compare(k1, k2);
+            ret_int[i] = (cmp < 0)?-1:((cmp > 0)?1:0);
+        }
+    }
+    else {
+        for (R_len_t i = 0; i < vectorize_length; ++i)
+        {
+            if (e1_cont.isNA(i) || e2_cont.isNA(i)) {
+                ret_int[i] = NA_INTEGER;
+                continue;
+            }
+
+            R_len_t     cur1_n = e1_cont.get(i).length();
+            const char* cur1_s = e1_cont.get(i).c_str();
+            R_len_t     cur2_n = e2_cont.get(i).length();
+            const char* cur2_s = e2_cont.get(i).c_str();
+
+            // cmp with collation
+            if (ascii) {  // all the strings are ASCII
+                ret_int[i] = ascii->compare(cur1_s, cur1_n, cur2_s, cur2_n);
+            }
+            else {
+                UErrorCode status = U_ZERO_ERROR;
+                ret_int[i] = (int)ucol_strcollUTF8(col,
+                                                   cur1_s, cur1_n, cur2_s, cur2_n, &status
+                                                  );
+                STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+            }
         }
-
-        R_len_t     cur1_n = e1_cont.get(i).length();
-        const char* cur1_s = e1_cont.get(i).c_str();
-        R_len_t     cur2_n = e2_cont.get(i).length();
-        const char* cur2_s = e2_cont.get(i).c_str();
-
-        // cmp with collation
-        UErrorCode status = U_ZERO_ERROR;
-        ret_int[i] = (int)ucol_strcollUTF8(col,
-                                           cur1_s, cur1_n, cur2_s, cur2_n, &status
-                                          );
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
     }
 
     if (col) {
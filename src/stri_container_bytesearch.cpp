@@ -43,6 +43,7 @@ StriContainerByteSearch::StriContainerByteSearch()
     : StriContainerUTF8()
 {
     this->matcher = NULL;
+    this->matcherASCIIci = NULL;
     this->flags = 0;
 }
 
@@ -57,6 +58,7 @@ StriContainerByteSearch::StriContainerByteSearch(SEXP rstr, R_len_t _nrecycle, u
 {
     this->flags = _flags;
     this->matcher = NULL;
+    this->matcherASCIIci = NULL;
 
     R_len_t n = get_n();
     for (R_len_t i=0; i<n; ++i) {
@@ -74,6 +76,7 @@ StriContainerByteSearch::StriContainerByteSearch(StriContainerByteSearch& contai
     :    StriContainerUTF8((StriContainerUTF8&)container)
 {
     this->matcher = NULL;
+    this->matcherASCIIci = NULL;
     this->flags = container.flags;
 }
 
@@ -99,11 +102,22 @@ StriContainerByteSearch::~StriContainerByteSearch()
         delete matcher;
         matcher = NULL;
     }
+
+    if (matcherASCIIci) {
+        delete matcherASCIIci;
+        matcherASCIIci = NULL;
+    }
 }
 
 
 /**
  * @version 0.5-1 (Marek Gagolewski, 2015-02-14)
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriByteSearchMatcherSIMD for patterns of length >= 2
+ *    if the CPU supports SSE2 or AVX2;
+ *    otherwise, use StriByteSearchMatcherHorspool for patterns
+ *    of length >= 16 (instead of StriByteSearchMatcherKMP)
  */
 StriByteSearchMatcher* StriContainerByteSearch::getMatcher(R_len_t i) {
     if (i >= n && matcher && matcher->getPatternStr() == get(i).c_str()) {
@@ -119,16 +133,56 @@ StriByteSearchMatcher* StriContainerByteSearch::getMatcher(R_len_t i) {
             matcher = new StriByteSearchMatcherKMPci(get(i).c_str(), get(i).length(), isOverlap());
         else if (get(i).length() == 1)
             matcher = new StriByteSearchMatcher1(get(i).c_str(), get(i).length(), isOverlap());
+#ifndef STRI__BYTESEARCH_DISABLE_SIMD
+        else if (stri__bytesearch_simd_level() != STRI_BYTESEARCH_SIMD_NONE)
+            matcher = new StriByteSearchMatcherSIMD(get(i).c_str(), get(i).length(), isOverlap());
+#endif
         else if (get(i).length() < 16)
             matcher = new StriByteSearchMatcherShort(get(i).c_str(), get(i).length(), isOverlap());
         else
-            matcher = new StriByteSearchMatcherKMP(get(i).c_str(), get(i).length(), isOverlap());
+            matcher = new StriByteSearchMatcherHorspool(get(i).c_str(), get(i).length(), isOverlap());
     }
 
     return matcher;
 }
 
 
+/** Get a matcher for the i-th pattern, already reset to a given haystack
+ *
+ * If the search is case-insensitive and both the pattern and
+ * the haystack are ASCII, StriByteSearchMatcherASCIIci is used
+ * instead of StriByteSearchMatcherKMPci.
+ *
+ * @param i index
+ * @param searchStr haystack
+ * @return matcher
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+StriByteSearchMatcher* StriContainerByteSearch::getMatcher(R_len_t i, const String8& searchStr)
+{
+    StriByteSearchMatcher* ret;
+    if (isCaseInsensitive() && searchStr.isASCII() && get(i).isASCII()) {
+        if (i >= n && matcherASCIIci && matcherASCIIci->getPatternStr() == get(i).c_str()) {
+            // matcher reuse
+        }
+        else {
+            if (matcherASCIIci) {
+                delete matcherASCIIci;
+                matcherASCIIci = NULL;
+            }
+            matcherASCIIci = new StriByteSearchMatcherASCIIci(get(i).c_str(), get(i).length(), isOverlap());
+        }
+        ret = matcherASCIIci;
+    }
+    else
+        ret = getMatcher(i);
+
+    ret->reset(searchStr.c_str(), searchStr.length());
+    return ret;
+}
+
+
 /** find first match - case of short pattern
  *
  * @param startPos where to start
@@ -386,6 +440,7 @@ StriByteSearchMatcher* StriContainerByteSearch::getMatcher(R_len_t i) {
  *
  * @param opts_fixed list
  * @param allow_overlap
+ * @param allow_simultaneous
  * @return flags
  *
  * @version 0.4-1 (Marek Gagolewski, 2014-12-07)
@@ -395,8 +450,12 @@ StriByteSearchMatcher* StriContainerByteSearch::getMatcher(R_len_t i) {
  *
  * @version 1.1.6 (Marek Gagolewski, 2017-11-10)
  *    PROTECT STRING_ELT(names, i)
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    add `simultaneous` option
  */
-uint32_t StriContainerByteSearch::getByteSearchFlags(SEXP opts_fixed, bool allow_overlap)
+uint32_t StriContainerByteSearch::getByteSearchFlags(SEXP opts_fixed,
+    bool allow_overlap, bool allow_simultaneous)
 {
     uint32_t flags = 0;
     if (!Rf_isNull(opts_fixed) && !Rf_isVectorList(opts_fixed))
@@ -426,6 +485,9 @@ uint32_t StriContainerByteSearch::getByteSearchFlags(SEXP opts_fixed, bool allow
             } else if  (!strcmp(curname, "overlap") && allow_overlap) {
                 bool val = stri__prepare_arg_logical_1_notNA(tmp_arg, "overlap");
                 if (val) flags |= BYTESEARCH_OVERLAP;
+            } else if  (!strcmp(curname, "simultaneous") && allow_simultaneous) {
+                bool val = stri__prepare_arg_logical_1_notNA(tmp_arg, "simultaneous");
+                if (val) flags |= BYTESEARCH_SIMULTANEOUS;
             } else {
                 Rf_warning(MSG__INCORRECT_FIXED_OPTION, curname);
             }
@@ -434,5 +496,8 @@ uint32_t StriContainerByteSearch::getByteSearchFlags(SEXP opts_fixed, bool allow
         UNPROTECT(1); /* names */
     }
 
+    if ((flags&BYTESEARCH_SIMULTANEOUS) && (flags&BYTESEARCH_CASE_INSENSITIVE))
+        Rf_error(MSG__FIXED_SIMULTANEOUS_CASE_INSENSITIVE); // error() call allowed here
+
     return flags;
 }
@@ -37,6 +37,7 @@
 #include "stri_bytesearch_matcher.h"
 
 // #define STRI__BYTESEARCH_DISABLE_SHORTPAT
+// #define STRI__BYTESEARCH_DISABLE_SIMD
 
 
 /**
@@ -67,6 +68,15 @@
  *
  * @version 1.3.1 (Marek Gagolewski, 2019-02-06)
  *          #337: warn on empty search pattern here
+ *
+ * @version 1.8.8 (2026-10-16)
+ *          StriByteSearchMatcherSIMD
+ *
+ * @version 1.8.8 (2026-10-16)
+ *          add `simultaneous` option
+ *
+ * @version 1.8.8 (2026-10-16)
+ *          StriByteSearchMatcherASCIIci for ASCII patterns and haystacks
  */
 class StriContainerByteSearch : public StriContainerUTF8 {
 
@@ -74,16 +84,19 @@ private:
 
     typedef enum ByteSearchFlag {
         BYTESEARCH_CASE_INSENSITIVE = 2,
-        BYTESEARCH_OVERLAP = 4
+        BYTESEARCH_OVERLAP = 4,
+        BYTESEARCH_SIMULTANEOUS = 8
     } ByteSearchFlag;
 
     StriByteSearchMatcher* matcher;
+    StriByteSearchMatcher* matcherASCIIci;
     uint32_t flags; ///< ByteSearch flags
 
 
 public:
 
-    static uint32_t getByteSearchFlags(SEXP opts_fixed, bool allow_overlap=false);
+    static uint32_t getByteSearchFlags(SEXP opts_fixed, bool allow_overlap=false,
+        bool allow_simultaneous=false);
 
     StriContainerByteSearch();
     StriContainerByteSearch(SEXP rstr, R_len_t nrecycle, uint32_t flags);
@@ -92,6 +105,7 @@ public:
     StriContainerByteSearch& operator=(StriContainerByteSearch& container);
 
     StriByteSearchMatcher* getMatcher(R_len_t i);
+    StriByteSearchMatcher* getMatcher(R_len_t i, const String8& searchStr);
 
     inline bool isCaseInsensitive() {
         return (bool)(flags&BYTESEARCH_CASE_INSENSITIVE);
@@ -100,6 +114,10 @@ public:
     inline bool isOverlap() {
         return (bool)(flags&BYTESEARCH_OVERLAP);
     }
+
+    inline bool isSimultaneous() {
+        return (bool)(flags&BYTESEARCH_SIMULTANEOUS);
+    }
 };
 
 #endif
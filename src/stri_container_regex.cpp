@@ -43,6 +43,9 @@ StriContainerRegexPattern::StriContainerRegexPattern()
 {
     this->lastMatcherIndex = -1;
     this->lastMatcher = NULL;
+    this->lastPattern = NULL;
+    this->lastAnchored = false;
+    this->lastPrefilter = NULL;
     this->lastCaptureGroupNamesIndex = -1;
     //this->lastCaptureGroupNames = ...
     //this->opts = 0;
@@ -60,6 +63,9 @@ StriContainerRegexPattern::StriContainerRegexPattern(SEXP rstr, R_len_t _nrecycl
 {
     this->lastMatcherIndex = -1;
     this->lastMatcher = NULL;
+    this->lastPattern = NULL;
+    this->lastAnchored = false;
+    this->lastPrefilter = NULL;
     this->lastCaptureGroupNamesIndex = -1;
     //this->lastCaptureGroupNames = ...
     this->opts = _opts;
@@ -81,6 +87,9 @@ StriContainerRegexPattern::StriContainerRegexPattern(StriContainerRegexPattern&
 {
     this->lastMatcherIndex = -1;
     this->lastMatcher = NULL;
+    this->lastPattern = NULL;
+    this->lastAnchored = false;
+    this->lastPrefilter = NULL;
     this->lastCaptureGroupNamesIndex = -1;
     //this->lastCaptureGroupNames = ...
     this->opts = container.opts;
@@ -93,6 +102,9 @@ StriContainerRegexPattern& StriContainerRegexPattern::operator=(StriContainerReg
     (StriContainerUTF16&) (*this) = (StriContainerUTF16&)container;
     this->lastMatcherIndex = -1;
     this->lastMatcher = NULL;
+    this->lastPattern = NULL;
+    this->lastAnchored = false;
+    this->lastPrefilter = NULL;
     this->lastCaptureGroupNamesIndex = -1;
     //this->lastCaptureGroupNames = ...
     this->opts = container.opts;
@@ -104,11 +116,30 @@ StriContainerRegexPattern& StriContainerRegexPattern::operator=(StriContainerReg
  *
  */
 StriContainerRegexPattern::~StriContainerRegexPattern()
+{
+    releaseMatcher();
+}
+
+
+/** Deletes the recently used matcher and gives back its compiled pattern
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriContainerRegexPattern::releaseMatcher()
 {
     if (lastMatcher) {
-        delete lastMatcher;
+        delete lastMatcher;  // must go before its pattern
         lastMatcher = NULL;
     }
+    if (lastPrefilter) {
+        delete lastPrefilter;  // must go before its pattern, too
+        lastPrefilter = NULL;
+    }
+    if (lastPattern) {
+        StriRegexPatternCache::release(lastPattern);
+        lastPattern = NULL;
+    }
+    lastMatcherIndex = -1;
 }
 
 
@@ -335,6 +366,10 @@ const std::vector<std::string>& StriContainerRegexPattern::getCaptureGroupNames(
  * for i >= this->n the last matcher is returned
  *
  * @param i index
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    compiled patterns are shared via StriRegexPatternCache;
+ *    set up the required literal prefilter, see mayMatch()
  */
 RegexMatcher* StriContainerRegexPattern::getMatcher(R_len_t i)
 {
@@ -343,17 +378,17 @@ RegexMatcher* StriContainerRegexPattern::getMatcher(R_len_t i)
             return lastMatcher; // reuse
         }
         else {
-            delete lastMatcher; // invalidate
-            this->lastMatcher = NULL;
+            releaseMatcher(); // invalidate
         }
     }
 
     UErrorCode status = U_ZERO_ERROR;
-    lastMatcher = new RegexMatcher(this->get(i), opts.flags, status);
+    lastPattern = StriRegexPatternCache::acquire(this->get(i), opts.flags, status);
+    if (U_SUCCESS(status))
+        lastMatcher = lastPattern->compiled->matcher(status);
 
     if (U_FAILURE(status)) {
-        if (lastMatcher) delete lastMatcher;
-        lastMatcher = NULL;
+        releaseMatcher();
 
         const char* context; // to ease debugging, #382
         std::string s;
@@ -369,6 +404,28 @@ RegexMatcher* StriContainerRegexPattern::getMatcher(R_len_t i)
 
     if (!lastMatcher) throw StriException(MSG__MEM_ALLOC_ERROR);
 
+    // a conservative check: `^...` or `\A...` with no alternatives
+    const UnicodeString& p = this->get(i);
+    lastAnchored = !(opts.flags & (UREGEX_MULTILINE|UREGEX_LITERAL)) &&
+        p.length() > 0 && (p[0] == (UChar)'^' ||
+            (p.length() > 1 && p[0] == (UChar)'\\' && p[1] == (UChar)'A')) &&
+        p.indexOf((UChar)'|') < 0;
+
+    // for anchored patterns, ICU fails fast anyway; a prefilter would
+    // need to scan whole strings
+    const std::string& literal = lastPattern->literal;
+    if (!lastAnchored && literal.length() >= 2) {
+#ifndef STRI__BYTESEARCH_DISABLE_SIMD
+        if (stri__bytesearch_simd_level() != STRI_BYTESEARCH_SIMD_NONE)
+            lastPrefilter = new StriByteSearchMatcherSIMD(literal.c_str(), literal.length(), false);
+        else
+#endif
+        if (literal.length() < 16)
+            lastPrefilter = new StriByteSearchMatcherShort(literal.c_str(), literal.length(), false);
+        else
+            lastPrefilter = new StriByteSearchMatcherHorspool(literal.c_str(), literal.length(), false);
+    }
+
     if (opts.stack_limit > 0) {
         lastMatcher->setStackLimit(opts.stack_limit, status);
         STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
@@ -386,6 +443,135 @@ RegexMatcher* StriContainerRegexPattern::getMatcher(R_len_t i)
 }
 
 
+/** Skip a character class (set) in a regex
+ *
+ * @param pattern regex
+ * @param k index of the first code unit after the opening `[`
+ * @return index of the first code unit after the closing `]` or -1
+ *    if in doubt
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+int32_t stri__regex_skip_set(const UnicodeString& pattern, int32_t k)
+{
+    int32_t n = pattern.length();
+    if (k < n && pattern.charAt(k) == (UChar)'^') ++k;
+    if (k < n && pattern.charAt(k) == (UChar)']') return -1;
+    int32_t depth = 1;
+    while (k < n && depth > 0) {
+        UChar e = pattern.charAt(k++);
+        if (e == (UChar)'\\' && k < n && pattern.charAt(k) == (UChar)'Q')
+            return -1;
+        else if (e == (UChar)'\\') ++k;
+        else if (e == (UChar)'[') ++depth;
+        else if (e == (UChar)']') --depth;
+    }
+    return (depth > 0)?-1:k;
+}
+
+
+/** Find a literal that each match of a regex must include
+ *
+ * A conservative analysis: only literal characters at the top level
+ * of the pattern are considered; groups, character classes,
+ * and quantified atoms break the current run of literals.
+ * If in doubt (alternation, inline flags, \Q...\E,
+ * case-insensitive matching, etc.), an empty string is returned.
+ *
+ * @param pattern regex (assumed to be syntactically correct)
+ * @param flags regex flags
+ * @return UTF-8 string, the longest such literal found or ""
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+std::string StriContainerRegexPattern::getRequiredLiteral(const UnicodeString& pattern, uint32_t flags)
+{
+    if (flags & (UREGEX_CASE_INSENSITIVE|UREGEX_COMMENTS))
+        return std::string();
+
+    UnicodeString best;
+    if (flags & UREGEX_LITERAL)
+        best = pattern;
+    else {
+        UnicodeString cur;
+        int32_t n = pattern.length();
+        int32_t k = 0;
+        while (k < n) {
+            UChar32 c = pattern.char32At(k);
+            k += U16_LENGTH(c);
+
+            UChar32 lit = -1;
+            if (c == (UChar32)'\\') {
+                if (k >= n) return std::string();
+                UChar32 d = pattern.char32At(k);
+                k += U16_LENGTH(d);
+                if (d < 0x80 && !(d >= '0' && d <= '9') &&
+                        !(d >= 'a' && d <= 'z') && !(d >= 'A' && d <= 'Z'))
+                    lit = d;  // escaped punctuation
+                else if (d < 0x80 && strchr("dDwWsSbBAZzGhHvVRXtnrfea", (char)d) != NULL)
+                    ;  // a character class, an assertion, or a control char
+                else
+                    return std::string();  // \p{..}, \x.., \Q, backrefs, etc.
+            }
+            else if (c == (UChar32)'|' || c == (UChar32)')')
+                return std::string();
+            else if (c == (UChar32)'?' || c == (UChar32)'*' || c == (UChar32)'+' || c == (UChar32)'{') {
+                // the preceding atom is optional or repeated
+                if (cur.length() > 0)
+                    cur.truncate(cur.moveIndex32(cur.length(), -1));
+                if (c == (UChar32)'{') {
+                    k = pattern.indexOf((UChar)'}', k);
+                    if (k < 0) return std::string();
+                    ++k;
+                }
+            }
+            else if (c == (UChar32)'(') {
+                if (k < n && pattern.charAt(k) == (UChar)'?') {
+                    UChar e = (k+1 < n)?pattern.charAt(k+1):0;
+                    if (e == 0 || e >= 0x80 || !strchr(":=!<>", (char)e))
+                        return std::string();  // inline flags etc.
+                }
+                int32_t depth = 1;  // skip the whole group
+                while (k < n && depth > 0) {
+                    UChar e = pattern.charAt(k++);
+                    if (e == (UChar)'\\' && k < n && pattern.charAt(k) == (UChar)'Q')
+                        return std::string();
+                    else if (e == (UChar)'\\') ++k;
+                    else if (e == (UChar)'(') ++depth;
+                    else if (e == (UChar)')') --depth;
+                    else if (e == (UChar)'[') {
+                        k = stri__regex_skip_set(pattern, k);
+                        if (k < 0) return std::string();
+                    }
+                }
+                if (depth > 0) return std::string();
+            }
+            else if (c == (UChar32)'[') {
+                k = stri__regex_skip_set(pattern, k);
+                if (k < 0) return std::string();
+            }
+            else if (c != (UChar32)'.' && c != (UChar32)'^' && c != (UChar32)'$')
+                lit = c;
+
+            if (lit >= 0)
+                cur.append(lit);
+            else {
+                if (cur.length() > best.length()) best = cur;
+                cur.remove();
+            }
+        }
+        if (cur.length() > best.length()) best = cur;
+    }
+
+    if (best.indexOf((UChar)0xfffd) >= 0)
+        return std::string();  // might stand for an invalid byte sequence
+
+    std::string out;
+    best.toUTF8String(out);
+    return out;
+}
+
+
 /** Read regex flags from a list
  *
  * may call Rf_error
@@ -475,3 +661,267 @@ StriRegexMatcherOptions StriContainerRegexPattern::getRegexOptions(SEXP opts_reg
     opts.stack_limit = stack_limit;
     return opts;
 }
+
+
+StriRegexPatternCache::List StriRegexPatternCache::lru;
+std::map<StriRegexPatternCache::Key, StriRegexPatternCache::List::iterator>
+    StriRegexPatternCache::index;
+R_len_t StriRegexPatternCache::capacity = 64;
+double StriRegexPatternCache::hits = 0.0;
+double StriRegexPatternCache::misses = 0.0;
+StriLock StriRegexPatternCache::lock;
+
+
+/** Get a compiled regex pattern, compiling it if necessary
+ *
+ * Each call must be paired with a call to release().
+ * Can be called from many threads at once.
+ *
+ * @param pattern regex source
+ * @param flags regex flags
+ * @param status [out] ICU error code; on failure, NULL is returned
+ *    and nothing is cached
+ * @return an entry with a compiled pattern
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+StriRegexPatternCacheEntry* StriRegexPatternCache::acquire(
+    const UnicodeString& pattern, uint32_t flags, UErrorCode& status)
+{
+    StriLockGuard guard(lock);
+
+    if (capacity > 0) {
+        std::map<Key, List::iterator>::iterator it = index.find(Key(pattern, flags));
+        if (it != index.end()) {
+            hits += 1.0;
+            StriRegexPatternCacheEntry* entry = *(it->second);
+            lru.splice(lru.begin(), lru, it->second);  // now most recently used
+            entry->refcount++;
+            return entry;
+        }
+    }
+
+    misses += 1.0;
+    RegexPattern* compiled = RegexPattern::compile(pattern, flags, status);
+    if (U_FAILURE(status)) {
+        if (compiled) delete compiled;
+        return NULL;
+    }
+    if (!compiled) throw StriException(MSG__MEM_ALLOC_ERROR);
+
+    StriRegexPatternCacheEntry* entry = new StriRegexPatternCacheEntry;
+    entry->pattern = pattern;
+    entry->flags = flags;
+    entry->compiled = compiled;
+    entry->literal = StriContainerRegexPattern::getRequiredLiteral(pattern, flags);
+    entry->refcount = 1;
+    entry->cached = false;
+
+    if (capacity > 0) {
+        evict(capacity-1);
+        lru.push_front(entry);
+        index[Key(pattern, flags)] = lru.begin();
+        entry->cached = true;
+    }
+
+    return entry;
+}
+
+
+/** Give back an entry obtained via acquire()
+ *
+ * All matchers created from entry->compiled must have been deleted already.
+ *
+ * @param entry cache entry
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriRegexPatternCache::release(StriRegexPatternCacheEntry* entry)
+{
+    StriLockGuard guard(lock);
+    entry->refcount--;
+    if (entry->refcount <= 0 && !entry->cached) {
+        delete entry->compiled;
+        delete entry;
+    }
+}
+
+
+/** Remove least recently used entries until at most max_size remain
+ *
+ * Entries still in use are freed upon their last release().
+ *
+ * @param max_size number of entries to keep
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriRegexPatternCache::evict(R_len_t max_size)
+{
+    if (max_size < 0) max_size = 0;
+    while ((R_len_t)lru.size() > max_size) {
+        StriRegexPatternCacheEntry* entry = lru.back();
+        lru.pop_back();
+        index.erase(Key(entry->pattern, entry->flags));
+        entry->cached = false;
+        if (entry->refcount <= 0) {
+            delete entry->compiled;
+            delete entry;
+        }
+    }
+}
+
+
+/** Set the maximal number of cached patterns; 0 disables caching
+ *
+ * @param new_capacity non-negative integer
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriRegexPatternCache::setCapacity(R_len_t new_capacity)
+{
+    StriLockGuard guard(lock);
+    if (new_capacity < 0) new_capacity = 0;
+    capacity = new_capacity;
+    evict(capacity);
+}
+
+
+/** Remove all cached patterns and reset the hit/miss counters
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriRegexPatternCache::clear()
+{
+    StriLockGuard guard(lock);
+    evict(0);
+    hits = 0.0;
+    misses = 0.0;
+}
+
+
+/** Default constructor
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+StriRegexHaystackUTF8::StriRegexHaystackUTF8()
+{
+    this->utext = NULL;
+    this->lastStr = NULL;
+    this->lastLen = -1;
+    this->curStr = NULL;
+    this->curLen = 0;
+    this->curASCII = true;
+    this->curUText = false;
+}
+
+
+/** Destructor
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+StriRegexHaystackUTF8::~StriRegexHaystackUTF8()
+{
+    if (utext) {
+        utext_close(utext);
+        utext = NULL;
+    }
+}
+
+
+/** Set the matcher's input to a given string
+ *
+ * The string must not be modified nor deallocated while the matcher
+ * is in use.
+ *
+ * @param matcher regex matcher
+ * @param s UTF-8 string, not NA
+ * @param use_utext whether the UTF-8 buffer is to be accessed directly
+ *     (via UText) or converted to UTF-16 first
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriRegexHaystackUTF8::reset(RegexMatcher* matcher, const String8& s, bool use_utext)
+{
+    curStr = s.c_str();
+    curLen = s.length();
+    curASCII = s.isASCII();
+    curUText = use_utext;
+
+    UErrorCode status = U_ZERO_ERROR;
+    if (use_utext) {
+        utext = utext_openUTF8(utext, curStr, curLen, &status);
+        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        matcher->reset(utext);
+    }
+    else {
+        if (lastStr != curStr || lastLen != curLen) {
+            // recycled haystacks are converted only once in a row
+            UChar* b = buf.getBuffer(curLen+1);  // #UChars <= #bytes
+            if (!b) throw StriException(MSG__MEM_ALLOC_ERROR);
+            int32_t blen = 0;
+            u_strFromUTF8WithSub(b, curLen+1, &blen, curStr, curLen,
+                0xfffd, NULL, &status);
+            buf.releaseBuffer(U_SUCCESS(status)?blen:0);
+            STRI__CHECKICUSTATUS_THROW(status, {lastStr = NULL;})
+            lastStr = curStr;
+            lastLen = curLen;
+        }
+        matcher->reset(buf);
+    }
+}
+
+
+/** Convert match offsets (as reported by the matcher) to code point indexes
+ *
+ * Works like StriContainerUTF16::UChar16_to_UChar32_index: NAs and negative
+ * values are left as-is, the other ones must be sorted nondecreasingly.
+ *
+ * @param i1 array of start offsets
+ * @param i2 array of end offsets
+ * @param ni size of i1 and i2
+ * @param adj1 value added to each i1
+ * @param adj2 value added to each i2
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriRegexHaystackUTF8::toUChar32Index(int* i1, int* i2, const int ni, int adj1, int adj2)
+{
+    if (curASCII) {  // bytes == UChars == code points
+        for (int j=0; j<ni; ++j) {
+            if (i1[j] != NA_INTEGER && i1[j] >= 0) i1[j] += adj1;
+            if (i2[j] != NA_INTEGER && i2[j] >= 0) i2[j] += adj2;
+        }
+        return;
+    }
+
+    const UChar* str16 = curUText?NULL:buf.getBuffer();
+    const int nstr = curUText?curLen:buf.length();
+
+    int j1 = 0;
+    int j2 = 0;
+    int ik = 0;   // current offset (byte or UChar)
+    int i32 = 0;  // current code point
+    while (true) {
+        while (j1 < ni && (i1[j1] == NA_INTEGER || i1[j1] < 0 || i1[j1] <= ik)) {
+            if (i1[j1] != NA_INTEGER && i1[j1] >= 0)
+                i1[j1] = i32 + adj1;
+            ++j1;
+        }
+
+        while (j2 < ni && (i2[j2] == NA_INTEGER || i2[j2] < 0 || i2[j2] <= ik)) {
+            if (i2[j2] != NA_INTEGER && i2[j2] >= 0)
+                i2[j2] = i32 + adj2;
+            ++j2;
+        }
+
+        if (ik >= nstr || (j1 >= ni && j2 >= ni))
+            break;
+
+        // Next UChar32
+        if (curUText)
+            U8_FWD_1(curStr, ik, nstr);
+        else
+            U16_FWD_1(str16, ik, nstr);
+        ++i32;
+    }
+}
@@ -36,8 +36,12 @@
 
 #include <unicode/regex.h>
 #include <vector>
-#include <vector>
+#include <list>
+#include <map>
 #include "stri_container_utf16.h"
+#include "stri_string8.h"
+#include "stri_bytesearch_matcher.h"
+#include "stri_thread.h"
 
 
 
@@ -53,6 +57,106 @@ struct StriRegexMatcherOptions {
 
 
 
+/** An entry in the compiled regex pattern cache,
+ * see StriRegexPatternCache
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+struct StriRegexPatternCacheEntry {
+    UnicodeString pattern;   ///< pattern source text
+    uint32_t flags;          ///< compile-time flags
+    RegexPattern* compiled;  ///< owned
+    std::string literal;     ///< UTF-8, see StriContainerRegexPattern::getRequiredLiteral
+    R_len_t refcount;        ///< number of matchers currently using `compiled`
+    bool cached;             ///< false if evicted or caching is disabled
+};
+
+
+/**
+ * A process-wide, bounded LRU cache of compiled regex patterns
+ *
+ * Compiled patterns are keyed by their source text and flags
+ * (stack and time limits are matcher-level settings, hence not
+ * a part of the key). Each user gets a fresh RegexMatcher
+ * via RegexPattern::matcher(), so no matcher state is shared.
+ *
+ * An entry evicted while it is still referenced is freed
+ * upon its last release().
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriRegexPatternCache {
+
+private:
+
+    typedef std::pair<UnicodeString, uint32_t> Key;
+    typedef std::list<StriRegexPatternCacheEntry*> List;
+
+    static List lru;  ///< most recently used first
+    static std::map<Key, List::iterator> index;
+    static R_len_t capacity;
+    static double hits;
+    static double misses;
+    static StriLock lock;  ///< guards all the above (see stri__parallel_for)
+
+    static void evict(R_len_t max_size);
+
+public:
+
+    static StriRegexPatternCacheEntry* acquire(
+        const UnicodeString& pattern, uint32_t flags, UErrorCode& status);
+    static void release(StriRegexPatternCacheEntry* entry);
+
+    static R_len_t getCapacity() { return capacity; }
+    static R_len_t getSize() { return (R_len_t)lru.size(); }
+    static double getHits() { return hits; }
+    static double getMisses() { return misses; }
+
+    static void setCapacity(R_len_t new_capacity);
+    static void clear();
+};
+
+
+/**
+ * Feeds UTF-8 strings (e.g., from StriContainerUTF8) to a RegexMatcher
+ * so that the whole haystack vector does not have to be converted
+ * to UTF-16 up front
+ *
+ * Either a UText over the UTF-8 bytes is used (no copying at all,
+ * match offsets are byte offsets) or the current string is converted
+ * to a reusable UTF-16 buffer (ICU matches UTF-16 input faster;
+ * match offsets are UTF-16 code unit offsets).
+ * The former pays off if the pattern is anchored at the start,
+ * see StriContainerRegexPattern::isAnchored.
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriRegexHaystackUTF8 {
+
+private:
+
+    UText* utext;         ///< reused between calls to reset()
+    UnicodeString buf;    ///< reused between calls to reset()
+    const char* lastStr;  ///< the string currently stored in `buf`
+    R_len_t lastLen;
+    const char* curStr;   ///< the string currently fed to the matcher
+    R_len_t curLen;
+    bool curASCII;
+    bool curUText;
+
+    StriRegexHaystackUTF8(const StriRegexHaystackUTF8&); // no copy
+    StriRegexHaystackUTF8& operator=(const StriRegexHaystackUTF8&);
+
+public:
+
+    StriRegexHaystackUTF8();
+    ~StriRegexHaystackUTF8();
+
+    void reset(RegexMatcher* matcher, const String8& s, bool use_utext);
+    void toUChar32Index(int* i1, int* i2, const int ni, int adj1, int adj2);
+};
+
+
 /**
  * A class to handle regex searches
  *
@@ -69,6 +173,9 @@ struct StriRegexMatcherOptions {
  *
  * @version 1.7.1 (Marek Gagolewski, 2021-06-19)
  *          #153: extract capture group names
+ *
+ * @version 1.8.8 (2026-10-16)
+ *          compiled patterns are taken from StriRegexPatternCache
  */
 class StriContainerRegexPattern : public StriContainerUTF16 {
 
@@ -76,14 +183,20 @@ private:
 
     StriRegexMatcherOptions opts; ///< RegexMatcher options
     RegexMatcher* lastMatcher; ///< recently used RegexMatcher
+    StriRegexPatternCacheEntry* lastPattern; ///< pattern used by lastMatcher
+    bool lastAnchored;         ///< see isAnchored()
+    StriByteSearchMatcher* lastPrefilter; ///< searches for lastPattern->literal
     R_len_t lastMatcherIndex;  ///< used by vectorize_getMatcher
 
     std::vector<std::string> lastCaptureGroupNames;
     R_len_t lastCaptureGroupNamesIndex;
 
+    void releaseMatcher();
+
 public:
 
     static StriRegexMatcherOptions getRegexOptions(SEXP opts_regex);
+    static std::string getRequiredLiteral(const UnicodeString& pattern, uint32_t flags);
 
     StriContainerRegexPattern();
     StriContainerRegexPattern(SEXP rstr, R_len_t nrecycle, StriRegexMatcherOptions opts);
@@ -91,6 +204,25 @@ public:
     ~StriContainerRegexPattern();
     StriContainerRegexPattern& operator=(StriContainerRegexPattern& container);
     RegexMatcher* getMatcher(R_len_t i);
+
+    /** Whether the pattern most recently passed to getMatcher()
+     * can only match at the start of a string
+     * (matching cost does not depend on the haystack's length then)
+     */
+    inline bool isAnchored() const { return lastAnchored; }
+
+    /** Quickly rejects strings that cannot match the pattern
+     * most recently passed to getMatcher(), because they do not
+     * include its required literal (if there is one)
+     *
+     * @param s UTF-8 string, not NA
+     * @return false if the regex certainly does not match s
+     */
+    inline bool mayMatch(const String8& s) {
+        if (!lastPrefilter) return true;
+        lastPrefilter->reset(s.c_str(), s.length());
+        return lastPrefilter->findFirst() != USEARCH_DONE;
+    }
     const std::vector<std::string>& getCaptureGroupNames(R_len_t i);
 
     SEXP getCaptureGroupRDimnames(R_len_t i, R_len_t last_i=-1, SEXP ret=R_NilValue);
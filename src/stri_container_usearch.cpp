@@ -81,6 +81,23 @@ StriContainerUStringSearch::StriContainerUStringSearch(StriContainerUStringSearc
 }
 
 
+/** Copy constructor, but use a different collator
+ *
+ * @param container source
+ * @param col Collator (e.g., a clone of the one used by \code{container});
+ *     owned by external caller
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+StriContainerUStringSearch::StriContainerUStringSearch(StriContainerUStringSearch& container, UCollator* _col)
+    :    StriContainerUTF16((StriContainerUTF16&)container)
+{
+    this->lastMatcherIndex = -1;
+    this->lastMatcher = NULL;
+    this->col = _col;
+}
+
+
 StriContainerUStringSearch& StriContainerUStringSearch::operator=(StriContainerUStringSearch& container)
 {
     this->~StriContainerUStringSearch();
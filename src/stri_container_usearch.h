@@ -55,6 +55,9 @@
  *
  * @version 1.3.1 (Marek Gagolewski, 2019-02-06)
  *          #337: warn on empty search pattern here
+ *
+ * @version 1.8.8 (2026-10-16)
+ *          copy constructor with another collator (multithreading)
  */
 class StriContainerUStringSearch : public StriContainerUTF16 {
 
@@ -70,6 +73,7 @@ public:
     StriContainerUStringSearch();
     StriContainerUStringSearch(SEXP rstr, R_len_t nrecycle, UCollator* col);
     StriContainerUStringSearch(StriContainerUStringSearch& container);
+    StriContainerUStringSearch(StriContainerUStringSearch& container, UCollator* col);
     ~StriContainerUStringSearch();
     StriContainerUStringSearch& operator=(StriContainerUStringSearch& container);
     UStringSearch* getMatcher(R_len_t i, const UnicodeString& searchStr);
@@ -116,75 +116,92 @@ StriContainerUTF16::StriContainerUTF16(SEXP rstr, R_len_t _nrecycle, bool _shall
             continue; // keep NA
         }
 
-        // if (IS_ASCII(curs)) {
-        //     // Version 1:
-        //     UConverter* ucnv = ucnvASCII.getConverter();
-        //     UErrorCode status = U_ZERO_ERROR;
-        //     this->str[i].setTo(
-        //         UnicodeString((const char*)CHAR(curs), (int32_t)LENGTH(curs), ucnv, status)
-        //     );
-        //     STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-        //
-        //     // Performance improvement attempt #1:
-        //     // this->str[i] = new UnicodeString(UnicodeString::fromUTF8(CHAR(curs)));
-        //     // if (!this->str) throw StriException(MSG__MEM_ALLOC_ERROR);
-        //     // slower than the above
-        //
-        //     // Performance improvement attempt #2:
-        //     // Create UChar buf with LENGTH(curs) items, fill it with (CHAR(curs)[i], 0x00), i=1,...
-        //     // This wasn't faster than the ucnvASCII approach.
-        //
-        //     // Performance improvement attempt #3:
-        //     // slightly slower than ucnvASCII
-        //     // R_len_t curs_n = LENGTH(curs);
-        //     // const char* curs_s = CHAR(curs);
-        //     // this->str[i].remove(); // unset bogus (NA)
-        //     // UChar* buf = this->str[i].getBuffer(curs_n);
-        //     // for (R_len_t k=0; k<curs_n; ++k)
-        //     //   buf[k] = (UChar)curs_s[k]; // well, this is ASCII :)
-        //     // this->str[i].releaseBuffer(curs_n);
-        // }
-        // else
-        if (IS_ASCII(curs) || IS_UTF8(curs)) {
-            // using ucnvUTF8 is slower for UTF-8
-            // the same is done for native encoding && ucnvNative_isUTF8
-
-            // this is slower if IS_ASCII than ucnvASCII, but doesn't limit
-            // the input string length to 858993458 characters (#487)
+        setFromR(i, curs, ucnvLatin1, ucnvNative);
+    }
+
+    if (!_shallowrecycle) {
+        for (R_len_t i=nrstr; i<this->n; ++i) {
+            this->str[i].setTo(str[i%nrstr]);
+        }
+    }
+}
+
+
+/** Convert a string from R and store it at a given position
+ *
+ * @param i index (no recycling)
+ * @param curs CHARSXP, not NA
+ * @param ucnvLatin1 Latin-1 (or WINDOWS-1252) converter
+ * @param ucnvNative native encoding converter
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    separated from the constructor
+ */
+void StriContainerUTF16::setFromR(R_len_t i, SEXP curs,
+    StriUcnv& ucnvLatin1, StriUcnv& ucnvNative)
+{
+    // if (IS_ASCII(curs)) {
+    //     // Version 1:
+    //     UConverter* ucnv = ucnvASCII.getConverter();
+    //     UErrorCode status = U_ZERO_ERROR;
+    //     this->str[i].setTo(
+    //         UnicodeString((const char*)CHAR(curs), (int32_t)LENGTH(curs), ucnv, status)
+    //     );
+    //     STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+    //
+    //     // Performance improvement attempt #1:
+    //     // this->str[i] = new UnicodeString(UnicodeString::fromUTF8(CHAR(curs)));
+    //     // if (!this->str) throw StriException(MSG__MEM_ALLOC_ERROR);
+    //     // slower than the above
+    //
+    //     // Performance improvement attempt #2:
+    //     // Create UChar buf with LENGTH(curs) items, fill it with (CHAR(curs)[i], 0x00), i=1,...
+    //     // This wasn't faster than the ucnvASCII approach.
+    //
+    //     // Performance improvement attempt #3:
+    //     // slightly slower than ucnvASCII
+    //     // R_len_t curs_n = LENGTH(curs);
+    //     // const char* curs_s = CHAR(curs);
+    //     // this->str[i].remove(); // unset bogus (NA)
+    //     // UChar* buf = this->str[i].getBuffer(curs_n);
+    //     // for (R_len_t k=0; k<curs_n; ++k)
+    //     //   buf[k] = (UChar)curs_s[k]; // well, this is ASCII :)
+    //     // this->str[i].releaseBuffer(curs_n);
+    // }
+    // else
+    if (IS_ASCII(curs) || IS_UTF8(curs)) {
+        // using ucnvUTF8 is slower for UTF-8
+        // the same is done for native encoding && ucnvNative_isUTF8
+
+        // this is slower if IS_ASCII than ucnvASCII, but doesn't limit
+        // the input string length to 858993458 characters (#487)
+        this->str[i].setTo(UnicodeString::fromUTF8(CHAR(curs)));
+    }
+    else if (IS_LATIN1(curs)) {
+        UConverter* ucnv = ucnvLatin1.getConverter();
+        UErrorCode status = U_ZERO_ERROR;
+        this->str[i].setTo(
+            UnicodeString((const char*)CHAR(curs), (int32_t)LENGTH(curs), ucnv, status)
+        );
+        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+    }
+    else if (IS_BYTES(curs)) {
+        throw StriException(MSG__BYTESENC);
+    }
+    else {
+        // an "unknown" (native) encoding may be set to UTF-8 (speedup)
+        if (ucnvNative.isUTF8()) {
+            // UTF-8
             this->str[i].setTo(UnicodeString::fromUTF8(CHAR(curs)));
         }
-        else if (IS_LATIN1(curs)) {
-            UConverter* ucnv = ucnvLatin1.getConverter();
+        else {
+            UConverter* ucnv = ucnvNative.getConverter();
             UErrorCode status = U_ZERO_ERROR;
             this->str[i].setTo(
                 UnicodeString((const char*)CHAR(curs), (int32_t)LENGTH(curs), ucnv, status)
             );
             STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
         }
-        else if (IS_BYTES(curs)) {
-            throw StriException(MSG__BYTESENC);
-        }
-        else {
-            // an "unknown" (native) encoding may be set to UTF-8 (speedup)
-            if (ucnvNative.isUTF8()) {
-                // UTF-8
-                this->str[i].setTo(UnicodeString::fromUTF8(CHAR(curs)));
-            }
-            else {
-                UConverter* ucnv = ucnvNative.getConverter();
-                UErrorCode status = U_ZERO_ERROR;
-                this->str[i].setTo(
-                    UnicodeString((const char*)CHAR(curs), (int32_t)LENGTH(curs), ucnv, status)
-                );
-                STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-            }
-        }
-    }
-
-    if (!_shallowrecycle) {
-        for (R_len_t i=nrstr; i<this->n; ++i) {
-            this->str[i].setTo(str[i%nrstr]);
-        }
     }
 }
 
@@ -36,6 +36,8 @@
 #include "stri_container_base.h"
 #include <vector>
 
+class StriUcnv;
+
 
 /**
  * A class to handle conversion between R character vectors
@@ -57,6 +59,9 @@
  *          UnicodeString::fromUTF8 (for speedup);
  *          str now is UnicodeString*, and not UnicodeString**;
  *          using UnicodeString::isBogus to represent NA
+ *
+ * @version 1.8.8 (2026-10-16)
+ *          setFromR
  */
 class StriContainerUTF16 : public StriContainerBase {
 
@@ -158,6 +163,11 @@ public:
 
     // @QUESTION: separate StriContainerUTF16_indexable?
     void UChar16_to_UChar32_index(R_len_t i, int* i1, int* i2, const int ni, int adj1, int adj2);
+
+
+protected:
+
+    void setFromR(R_len_t i, SEXP curs, StriUcnv& ucnvLatin1, StriUcnv& ucnvNative);
 };
 
 
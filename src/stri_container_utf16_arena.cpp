@@ -0,0 +1,143 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "stri_stringi.h"
+#include "stri_container_utf16_arena.h"
+#include "stri_ucnv.h"
+
+
+/**
+ * Construct String Container from an R character vector
+ *
+ * The arena is allocated once: UTF-8 and 8-bit strings never need
+ * more UChars than they have bytes.
+ *
+ * @param rstr R character vector
+ * @param nrecycle extend length [vectorization]
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+StriContainerUTF16_arena::StriContainerUTF16_arena(SEXP rstr, R_len_t _nrecycle)
+{
+#ifndef NDEBUG
+    if (!Rf_isString(rstr))
+        throw StriException("DEBUG: !Rf_isString in StriContainerUTF16_arena::StriContainerUTF16_arena(SEXP rstr)");
+#endif
+    R_len_t nrstr = LENGTH(rstr);
+    this->init_Base(nrstr, _nrecycle, true);
+
+    if (this->n == 0)
+        return; /* nothing more to do */
+
+    size_t nbytes = 0;
+    for (R_len_t i=0; i<nrstr; ++i) {
+        SEXP curs = STRING_ELT(rstr, i);
+        if (curs != NA_STRING) nbytes += LENGTH(curs);
+    }
+
+    data.resize(nbytes+1);  // never empty
+    offset.resize(nrstr);
+    length.resize(nrstr);
+
+#if defined(_WIN32) || defined(_WIN64)
+    // #270: latin-1 is windows-1252 on Windows
+    StriUcnv ucnvLatin1("WINDOWS-1252");
+#else
+    StriUcnv ucnvLatin1("ISO-8859-1");
+#endif
+    StriUcnv ucnvNative(NULL);
+
+    size_t cur = 0;
+    for (R_len_t i=0; i<nrstr; ++i) {
+        SEXP curs = STRING_ELT(rstr, i);
+        offset[i] = cur;
+        if (curs == NA_STRING) {
+            length[i] = -1;
+            continue;
+        }
+
+        const char* curs_s = CHAR(curs);
+        int32_t curs_n = LENGTH(curs);
+        if (IS_ASCII(curs)) {
+            UChar* buf = data.data()+cur;
+            for (int32_t k=0; k<curs_n; ++k)
+                buf[k] = (UChar)(unsigned char)curs_s[k];
+            length[i] = curs_n;
+        }
+        else if (IS_UTF8(curs) || (!IS_LATIN1(curs) && !IS_BYTES(curs) && ucnvNative.isUTF8())) {
+            // the same as UnicodeString::fromUTF8
+            UErrorCode status = U_ZERO_ERROR;
+            u_strFromUTF8WithSub(data.data()+cur, getCapacity(cur),
+                &length[i], curs_s, curs_n, 0xfffd, NULL, &status);
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        }
+        else if (IS_LATIN1(curs)) {
+            length[i] = convert(ucnvLatin1.getConverter(), cur, curs_s, curs_n);
+        }
+        else if (IS_BYTES(curs)) {
+            throw StriException(MSG__BYTESENC);
+        }
+        else {
+            length[i] = convert(ucnvNative.getConverter(), cur, curs_s, curs_n);
+        }
+
+        cur += length[i];
+    }
+}
+
+
+/** Convert a string in an 8-bit or a multibyte encoding,
+ *  store the result at a given position in the arena
+ *
+ * The arena is extended if necessary.
+ *
+ * @param ucnv converter
+ * @param at position in data
+ * @param s string
+ * @param n number of bytes
+ * @return number of UChars written
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+int32_t StriContainerUTF16_arena::convert(UConverter* ucnv, size_t at, const char* s, int32_t n)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t len = ucnv_toUChars(ucnv, data.data()+at, getCapacity(at), s, n, &status);
+    if (status == U_BUFFER_OVERFLOW_ERROR) {
+        // keep the space reserved for the remaining strings
+        data.resize(data.size()+len);
+        status = U_ZERO_ERROR;
+        len = ucnv_toUChars(ucnv, data.data()+at, getCapacity(at), s, n, &status);
+    }
+    STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+    return len;
+}
@@ -0,0 +1,125 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef __stri_container_utf16_arena_h
+#define __stri_container_utf16_arena_h
+
+#include "stri_container_base.h"
+#include <vector>
+
+
+/**
+ * A read-only container of UTF-16 strings converted from an R character
+ * vector, all stored one after another in a single UChar arena
+ *
+ * Unlike in StriContainerUTF16, there are no per-string heap allocations
+ * (one UnicodeString buffer for each element), which matters for long
+ * vectors. Meant for functions that pass `(const UChar*, length)`
+ * to ICU, e.g., usearch or ucol_getSortKey. get() returns a read-only
+ * UnicodeString aliasing the arena.
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriContainerUTF16_arena : public StriContainerBase {
+
+private:
+
+    std::vector<UChar> data;      ///< all the strings
+    std::vector<size_t> offset;   ///< where each string starts in data
+    std::vector<int32_t> length;  ///< string lengths in UChars; -1 for NA
+
+    StriContainerUTF16_arena(const StriContainerUTF16_arena&);  // no copy
+    StriContainerUTF16_arena& operator=(const StriContainerUTF16_arena&);
+
+    int32_t convert(UConverter* ucnv, size_t at, const char* s, int32_t n);
+
+    /** the number of UChars available in data from a given position */
+    inline int32_t getCapacity(size_t at) const {
+        size_t cap = data.size()-at;
+        return (cap > (size_t)INT32_MAX)?INT32_MAX:(int32_t)cap;
+    }
+
+
+public:
+
+    StriContainerUTF16_arena(SEXP rstr, R_len_t nrecycle);
+
+
+    /** check if the vectorized ith element is NA
+     * @param i index
+     * @return true if is NA
+     */
+    inline bool isNA(R_len_t i) const {
+#ifndef NDEBUG
+        if (i < 0 || i >= nrecycle)
+            throw StriException("StriContainerUTF16_arena::isNA(): INDEX OUT OF BOUNDS");
+#endif
+        return length[i%n] < 0;
+    }
+
+
+    /** get the vectorized ith element's data
+     * @param i index
+     * @return pointer to the UTF-16 code units (not NUL-terminated)
+     */
+    inline const UChar* getBuffer(R_len_t i) const {
+#ifndef NDEBUG
+        if (isNA(i))
+            throw StriException("StriContainerUTF16_arena::getBuffer(): isNA");
+#endif
+        return data.data()+offset[i%n];
+    }
+
+
+    /** get the vectorized ith element's length
+     * @param i index
+     * @return number of UChars
+     */
+    inline int32_t getLength(R_len_t i) const {
+#ifndef NDEBUG
+        if (isNA(i))
+            throw StriException("StriContainerUTF16_arena::getLength(): isNA");
+#endif
+        return length[i%n];
+    }
+
+
+    /** get the vectorized ith element
+     * @param i index
+     * @return a read-only alias, valid as long as the container is
+     */
+    inline UnicodeString get(R_len_t i) const {
+        return UnicodeString(false, getBuffer(i), getLength(i));  // read-only alias
+    }
+};
+
+#endif
@@ -0,0 +1,181 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "stri_stringi.h"
+#include "stri_container_utf16_chunked.h"
+#include <algorithm>
+#include <unicode/utf8.h>
+
+
+/** Is a string valid UTF-8, i.e., would it survive
+ *  a round trip via UTF-16 byte-to-byte?
+ *
+ * @param s string
+ * @param n number of bytes
+ * @return bool
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static bool stri__is_valid_utf8(const char* s, R_len_t n)
+{
+    UChar32 c;
+    for (R_len_t j=0; j < n; ) {
+        if ((uint8_t)s[j] < 0x80) {
+            ++j;  // ASCII
+            continue;
+        }
+
+        U8_NEXT(s, j, n, c);
+        if (c < 0)
+            return false;  // would be replaced with U+FFFD
+    }
+    return true;
+}
+
+
+/**
+ * Construct String Container for an R character vector;
+ * call nextChunk() to convert the first chunk
+ *
+ * @param rstr R character vector
+ * @param chunk_size maximal number of strings in a chunk
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+StriContainerUTF16_chunked::StriContainerUTF16_chunked(SEXP _rstr, R_len_t chunk_size)
+    : StriContainerUTF16(std::min(LENGTH(_rstr), chunk_size)),
+#if defined(_WIN32) || defined(_WIN64)
+      // #270: latin-1 is windows-1252 on Windows
+      ucnvLatin1("WINDOWS-1252"),
+#else
+      ucnvLatin1("ISO-8859-1"),
+#endif
+      ucnvNative(NULL)
+{
+#ifndef NDEBUG
+    if (!Rf_isString(_rstr))
+        throw StriException("DEBUG: !Rf_isString in StriContainerUTF16_chunked::StriContainerUTF16_chunked(SEXP rstr)");
+#endif
+    this->rstr = _rstr;
+    this->rstr_n = LENGTH(_rstr);
+    this->chunk_start = 0;
+    this->chunk_capacity = this->n;
+    this->reusable.resize(this->chunk_capacity, false);
+    this->unchanged.resize(this->chunk_capacity, false);
+    this->n = this->nrecycle = 0;  // no chunk yet
+}
+
+
+/**
+ * Convert the next chunk of strings
+ *
+ * @param quick_check NULL or a check applied on ASCII and UTF-8 strings
+ *    before conversion; those that pass it are marked as unchanged
+ *    and are not converted
+ *
+ * @return false if there are no more strings
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+bool StriContainerUTF16_chunked::nextChunk(const StriUTF8QuickCheck* quick_check)
+{
+    chunk_start += this->n;
+    if (chunk_start >= rstr_n || !this->str) {
+        this->n = this->nrecycle = 0;
+        return false;
+    }
+
+    this->n = this->nrecycle = std::min(chunk_capacity, rstr_n-chunk_start);
+    for (R_len_t i=0; i<this->n; ++i) {
+        SEXP curs = STRING_ELT(rstr, chunk_start+i);
+        unchanged[i] = false;
+        if (curs == NA_STRING) {
+            reusable[i] = false;
+            this->str[i].setToBogus();
+            continue;
+        }
+
+        bool is_ascii = IS_ASCII(curs);
+        reusable[i] = is_ascii ||
+            (IS_UTF8(curs) && stri__is_valid_utf8(CHAR(curs), LENGTH(curs)));
+
+        if (quick_check && reusable[i] &&
+                quick_check->isUnchanged(CHAR(curs), LENGTH(curs), is_ascii)) {
+            unchanged[i] = true;
+            this->str[i].remove();  // not NA, not converted
+        }
+        else
+            setFromR(i, curs, ucnvLatin1, ucnvNative);
+    }
+
+    return true;
+}
+
+
+/**
+ * Export the current chunk to R
+ *
+ * THE OUTPUT IS ALWAYS IN UTF-8; the strings marked as unchanged
+ * whose CHARSXPs are in ASCII or UTF-8 are copied from rstr as they are
+ *
+ * @param ret character vector of the same length as rstr,
+ *    the chunk is stored at the corresponding positions
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriContainerUTF16_chunked::toRChunk(SEXP ret)
+{
+    for (R_len_t i=0; i<this->n; ++i) {
+        if (this->str[i].isBogus()) {
+            SET_STRING_ELT(ret, chunk_start+i, NA_STRING);
+            continue;
+        }
+
+        if (unchanged[i] && reusable[i]) {
+            SET_STRING_ELT(ret, chunk_start+i, STRING_ELT(rstr, chunk_start+i));
+            continue;
+        }
+
+        // One UChar -- <= U+FFFF  -> 1-3 bytes UTF8
+        // Two UChars -- >=U+10000 ->   4 bytes UTF8
+        size_t bufsize = UCNV_GET_MAX_BYTES_FOR_STRING(this->str[i].length(), 3);
+        if (outbuf.size() < bufsize) outbuf.resize(bufsize);
+
+        UErrorCode status = U_ZERO_ERROR;
+        int outrealsize = 0;
+        u_strToUTF8(outbuf.data(), (int32_t)outbuf.size(), &outrealsize,
+                    this->str[i].getBuffer(), this->str[i].length(), &status);
+        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        SET_STRING_ELT(ret, chunk_start+i,
+                       Rf_mkCharLenCE(outbuf.data(), outrealsize, (cetype_t)CE_UTF8));
+    }
+}
@@ -0,0 +1,138 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef __stri_container_utf16_chunked_h
+#define __stri_container_utf16_chunked_h
+
+#include "stri_container_utf16.h"
+#include "stri_ucnv.h"
+#include <vector>
+
+
+/// the default number of strings in a chunk
+#define STRI__UTF16_CHUNK_SIZE 1024
+
+
+/**
+ * A quick check telling whether a transform is certain to leave
+ * a string as-is, see StriContainerUTF16_chunked::nextChunk()
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriUTF8QuickCheck {
+public:
+    virtual ~StriUTF8QuickCheck() { }
+
+    /**
+     * @param s a valid UTF-8 string (not NUL-terminated)
+     * @param n its length in bytes
+     * @param is_ascii whether s is known to be ASCII
+     * @return true if the transformed string equals s;
+     *     false if it might not
+     */
+    virtual bool isUnchanged(const char* s, R_len_t n, bool is_ascii) const = 0;
+};
+
+
+/**
+ * A writable StriContainerUTF16 that holds a chunk of consecutive
+ * strings from an R character vector at a time
+ *
+ * Meant for transforming huge vectors: each chunk is converted to UTF-16,
+ * modified in place, and exported to R with toRChunk(); then its
+ * UnicodeStrings are reused for the next one. This way, the memory needed
+ * on top of the input and output vectors is O(chunk size), not O(n).
+ *
+ * Indexes passed to isNA(), get(), getWritable(), set() are relative
+ * to the current chunk, see getChunkStart(); get_n() gives
+ * the number of strings in the current chunk. There is no recycling.
+ *
+ * Strings that a transform leaves intact can be marked with setUnchanged();
+ * if the original CHARSXP is in ASCII or valid UTF-8, toRChunk() reuses it
+ * instead of re-encoding the string and looking it up in R's global
+ * string cache. nextChunk() may also be given a StriUTF8QuickCheck; the
+ * strings that pass it are marked as unchanged without being converted
+ * at all (then get(i) is empty).
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriContainerUTF16_chunked : public StriContainerUTF16 {
+
+private:
+
+    SEXP rstr;                ///< the source R character vector
+    R_len_t rstr_n;           ///< its length
+    R_len_t chunk_start;      ///< index in rstr of str[0]
+    R_len_t chunk_capacity;   ///< maximal number of strings in a chunk
+    std::vector<char> outbuf; ///< for toRChunk()
+    std::vector<bool> reusable;   ///< is the i-th CHARSXP ASCII or valid UTF-8?
+    std::vector<bool> unchanged;  ///< setUnchanged() on the i-th string?
+
+    StriUcnv ucnvLatin1;
+    StriUcnv ucnvNative;
+
+    StriContainerUTF16_chunked(const StriContainerUTF16_chunked&);  // no copy
+    StriContainerUTF16_chunked& operator=(const StriContainerUTF16_chunked&);
+
+
+public:
+
+    StriContainerUTF16_chunked(SEXP rstr, R_len_t chunk_size=STRI__UTF16_CHUNK_SIZE);
+
+    bool nextChunk(const StriUTF8QuickCheck* quick_check=NULL);
+    void toRChunk(SEXP ret);
+
+    /** mark the i-th string in the chunk as not modified by a transform */
+    inline void setUnchanged(R_len_t i) {
+#ifndef NDEBUG
+        if (i < 0 || i >= this->n)
+            throw StriException("StriContainerUTF16_chunked::setUnchanged(): INDEX OUT OF BOUNDS");
+#endif
+        unchanged[i] = true;
+    }
+
+    /** has the i-th string in the chunk been marked as unchanged? */
+    inline bool isUnchanged(R_len_t i) const {
+#ifndef NDEBUG
+        if (i < 0 || i >= this->n)
+            throw StriException("StriContainerUTF16_chunked::isUnchanged(): INDEX OUT OF BOUNDS");
+#endif
+        return unchanged[i];
+    }
+
+    /** index in the R character vector of the current chunk's first string */
+    inline R_len_t getChunkStart() const {
+        return chunk_start;
+    }
+};
+
+#endif
@@ -54,8 +54,14 @@ SEXP stri_rank(SEXP str, SEXP opts_collator=R_NilValue);
 SEXP stri_order(SEXP str, SEXP decreasing=Rf_ScalarLogical(FALSE),
     SEXP na_last=Rf_ScalarLogical(TRUE), SEXP opts_collator=R_NilValue);
 SEXP stri_sort_key(SEXP str, SEXP opts_collator=R_NilValue);
+SEXP stri_sort_topk(SEXP str, SEXP k, SEXP decreasing=Rf_ScalarLogical(FALSE),
+    SEXP na_last=Rf_ScalarLogical(NA_LOGICAL), SEXP opts_collator=R_NilValue);
+SEXP stri_order_topk(SEXP str, SEXP k, SEXP decreasing=Rf_ScalarLogical(FALSE),
+    SEXP na_last=Rf_ScalarLogical(TRUE), SEXP opts_collator=R_NilValue);
 
 SEXP stri_unique(SEXP str, SEXP opts_collator=R_NilValue);
+SEXP stri_group(SEXP str, SEXP sort=Rf_ScalarLogical(FALSE),
+    SEXP opts_collator=R_NilValue);
 SEXP stri_duplicated(SEXP str, SEXP fromLast=Rf_ScalarLogical(FALSE),
     SEXP opts_collator=R_NilValue);
 SEXP stri_duplicated_any(SEXP str, SEXP fromLast=Rf_ScalarLogical(FALSE),
@@ -63,6 +69,8 @@ SEXP stri_duplicated_any(SEXP str, SEXP fromLast=Rf_ScalarLogical(FALSE),
 
 // ICU_settings.cpp:
 SEXP stri_info();
+SEXP stri_regex_cache(SEXP capacity=R_NilValue, SEXP clear=Rf_ScalarLogical(FALSE));
+SEXP stri_collator_cache(SEXP capacity=R_NilValue, SEXP clear=Rf_ScalarLogical(FALSE));
 
 // escape.cpp
 SEXP stri_escape_unicode(SEXP str);
@@ -194,6 +202,13 @@ SEXP stri_replace_na(SEXP str, SEXP replacement=Rf_mkString("NA"));
 
 SEXP stri_replace_rstr(SEXP x);
 
+SEXP stri_in_fixed(SEXP str, SEXP table, SEXP nomatch=Rf_ScalarInteger(NA_INTEGER));
+SEXP stri_in_coll(SEXP str, SEXP table, SEXP nomatch=Rf_ScalarInteger(NA_INTEGER),
+    SEXP opts_collator=R_NilValue);
+SEXP stri_in_index(SEXP table, SEXP opts_collator=R_NilValue,
+    SEXP fixed=Rf_ScalarLogical(FALSE));
+SEXP stri_in_index_info(SEXP index);
+
 SEXP stri_detect_coll(SEXP str, SEXP pattern,
     SEXP negate=Rf_ScalarLogical(FALSE), SEXP max_count=Rf_ScalarInteger(-1),
     SEXP opts_collator=R_NilValue);
@@ -238,6 +253,8 @@ SEXP stri_subset_coll_replacement(SEXP str, SEXP pattern, SEXP negate, SEXP opts
 SEXP stri_detect_fixed(SEXP str, SEXP pattern,
     SEXP negate=Rf_ScalarLogical(FALSE), SEXP max_count=Rf_ScalarInteger(-1),
     SEXP opts_fixed=R_NilValue);
+SEXP stri_detect_fixed_any(SEXP str, SEXP pattern, SEXP mode=Rf_mkString("any"),
+    SEXP opts_fixed=R_NilValue);
 SEXP stri_count_fixed(SEXP str, SEXP pattern, SEXP opts_fixed=R_NilValue);
 SEXP stri_locate_all_fixed(
     SEXP str, SEXP pattern,
@@ -288,6 +305,8 @@ SEXP stri_detect_regex(
     SEXP max_count=Rf_ScalarInteger(-1),
     SEXP opts_regex=R_NilValue
 );
+SEXP stri_detect_regex_any(SEXP str, SEXP pattern, SEXP mode=Rf_mkString("any"),
+    SEXP opts_regex=R_NilValue);
 SEXP stri_count_regex(SEXP str, SEXP pattern, SEXP opts_regex=R_NilValue);
 SEXP stri_locate_all_regex(
     SEXP str, SEXP pattern,
@@ -449,5 +468,6 @@ SEXP stri_test_UnicodeContainer16(SEXP str);
 SEXP stri_test_UnicodeContainer16b(SEXP str);
 SEXP stri_test_UnicodeContainer8(SEXP str);
 SEXP stri_test_returnasis(SEXP x);
+SEXP stri_test_bytesearch(SEXP str, SEXP pattern, SEXP matcher, SEXP overlap);
 
 #endif
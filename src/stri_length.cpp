@@ -91,9 +91,14 @@ R_len_t stri__numbytes_max(SEXP str)
  *
  * @version 1.6.3 (Marek Gagolewski, 2021-05-22)
  *    use stri__length_string for UTF-8
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_length(SEXP str)
 {
+    STRI__DEDUP_DISPATCH(str, true,
+        stri_length(str))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
 
     STRI__ERROR_HANDLER_BEGIN(1)
@@ -490,9 +495,14 @@ int stri__width_string(const char* str_cur_s, int str_cur_n, int max_width)
   * @return integer vector
   *
   * @version 0.5-1 (Marek Gagolewski, 2015-04-22)
-  */
+  *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
+ */
 SEXP stri_width(SEXP str)
 {
+    STRI__DEDUP_DISPATCH(str, true,
+        stri_width(str))
     PROTECT(str = stri__prepare_arg_string(str, "str")); // prepare string argument
 
     STRI__ERROR_HANDLER_BEGIN(1)
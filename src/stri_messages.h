@@ -204,6 +204,9 @@
 #define MSG__FIXED_CONFIG_FAILED \
    "fixed search engine configuration failed"
 
+#define MSG__FIXED_SIMULTANEOUS_CASE_INSENSITIVE \
+   "`simultaneous` and `case_insensitive` cannot be used together"
+
 #define MSG__STRSEARCH_FAILED \
    "string search failed"
 
@@ -360,6 +363,12 @@
 #define MSG__U_CHARSET_IS_UTF8 \
    "system ICU assumes that the default character set is always UTF-8, and hence this function has no effect"
 
+#define MSG__ARG_EXPECTED_STRING_INDEX \
+   "argument `%s` should be a string index created by stri_in_index()"
+
+#define MSG__STRING_INDEX_MODE_MISMATCH \
+   "argument `%s` is a string index for %s comparisons, which cannot be used in this context"
+
 #define MSG__CHARSXP_2147483647 \
     "Elements of character vectors (CHARSXPs) are limited to 2^31-1 bytes"
 
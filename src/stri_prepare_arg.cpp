@@ -32,6 +32,13 @@
 
 #include "stri_stringi.h"
 #include <unicode/uloc.h>
+#include <vector>
+#include <stdint.h>
+
+
+// see stri__prepare_arg_string_dedup
+#define STRI__DEDUP_MIN_LENGTH  4096
+#define STRI__DEDUP_SAMPLE_SIZE 1024
 
 
 
@@ -298,6 +305,329 @@ SEXP stri__prepare_arg_list_string(SEXP x, const char* argname)
 }
 
 
+/**
+ * Is x a plain factor, i.e., one for which as.character(x)
+ * is the same as levels(x)[x]?
+ *
+ * Objects of classes derived from "factor" may have their own
+ * as.character methods, hence only "factor" and c("ordered", "factor")
+ * are considered here.
+ *
+ * @param x object
+ * @return bool
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+bool stri__is_plain_factor(SEXP x)
+{
+    if (TYPEOF(x) != INTSXP || !Rf_isObject(x))
+        return false;
+
+    SEXP cls = Rf_getAttrib(x, R_ClassSymbol);
+    if (!Rf_isString(cls) || LENGTH(cls) < 1 || LENGTH(cls) > 2)
+        return false;
+    R_len_t ncls = LENGTH(cls);
+    if (strcmp(CHAR(STRING_ELT(cls, ncls-1)), "factor") != 0)
+        return false;
+    if (ncls == 2 && strcmp(CHAR(STRING_ELT(cls, 0)), "ordered") != 0)
+        return false;
+
+    return (bool)Rf_isString(Rf_getAttrib(x, R_LevelsSymbol));
+}
+
+
+/**
+ * Convert a plain factor to a character vector, levels(x)[x],
+ * without calling as.character
+ *
+ * @param x a plain factor, see stri__is_plain_factor
+ * @return character vector or R_NilValue if x has invalid codes
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri__factor_as_character(SEXP x)
+{
+    SEXP levels = Rf_getAttrib(x, R_LevelsSymbol);
+    R_len_t nlevels = LENGTH(levels);
+    R_len_t n = LENGTH(x);
+    const int* codes = INTEGER(x);
+
+    SEXP ret;
+    PROTECT(ret = Rf_allocVector(STRSXP, n));
+    for (R_len_t i=0; i<n; ++i) {
+        if (codes[i] == NA_INTEGER)
+            SET_STRING_ELT(ret, i, NA_STRING);
+        else if (codes[i] >= 1 && codes[i] <= nlevels)
+            SET_STRING_ELT(ret, i, STRING_ELT(levels, codes[i]-1));
+        else {
+            UNPROTECT(1);
+            return R_NilValue;  // let as.character deal with it
+        }
+    }
+    UNPROTECT(1);
+    return ret;
+}
+
+
+/**
+ * Prepare a factor for level-wise processing, see STRI__DEDUP_DISPATCH
+ *
+ * Determines the levels that are actually in use (plus NA_character_
+ * if there are missing values), in the order of first appearance.
+ * A vectorised function whose result for each element of `str`
+ * depends on that element only can be called on these, and
+ * its result expanded by means of stri__dedup_gather.
+ *
+ * @param x object
+ * @param levels [out] character vector with the levels in use
+ * @return R_NilValue if x is not a plain factor with fewer levels
+ *    than elements; otherwise an integer vector of the same length as x,
+ *    giving 0-based indexes into *levels
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri__prepare_arg_factor(SEXP x, SEXP* levels)
+{
+    *levels = R_NilValue;
+    if (!stri__is_plain_factor(x))
+        return R_NilValue;
+
+    SEXP all_levels = Rf_getAttrib(x, R_LevelsSymbol);
+    R_len_t nlevels = LENGTH(all_levels);
+    R_len_t n = LENGTH(x);
+    if (nlevels >= n)
+        return R_NilValue;  // nothing to gain
+
+    const int* codes = INTEGER(x);
+    std::vector<int> remap(nlevels+1, -1);  // remap[0] is for NAs
+    R_len_t nused = 0;
+
+    SEXP index;
+    PROTECT(index = Rf_allocVector(INTSXP, n));
+    int* index_tab = INTEGER(index);
+    for (R_len_t i=0; i<n; ++i) {
+        int c = codes[i];
+        if (c == NA_INTEGER)
+            c = 0;
+        else if (c < 1 || c > nlevels) {
+            UNPROTECT(1);
+            return R_NilValue;  // invalid code
+        }
+
+        if (remap[c] < 0)
+            remap[c] = nused++;
+        index_tab[i] = remap[c];
+    }
+
+    SEXP used;
+    PROTECT(used = Rf_allocVector(STRSXP, nused));
+    for (R_len_t c=0; c<=nlevels; ++c) {
+        if (remap[c] >= 0)
+            SET_STRING_ELT(used, remap[c],
+                (c == 0)?NA_STRING:STRING_ELT(all_levels, c-1));
+    }
+
+    UNPROTECT(2);
+    *levels = used;
+    return index;
+}
+
+
+/* Assigns consecutive ids to CHARSXPs, which are compared by pointer:
+ * R caches CHARSXPs, hence equal strings in the same encoding share one.
+ * Open addressing with linear probing; the table grows as needed.
+ */
+class StriCharsxpIds {
+private:
+    std::vector<SEXP> m_key;  // NULL denotes an empty slot
+    std::vector<int> m_id;
+    std::vector<SEXP> m_values;  // id -> CHARSXP
+    size_t m_mask;
+
+    static size_t hash(SEXP s)
+    {
+        size_t h = (size_t)((uintptr_t)s >> 3);
+        h ^= h >> 16;
+        h *= 0x45d9f3bU;
+        h ^= h >> 16;
+        return h;
+    }
+
+    void rehash()
+    {
+        size_t capacity = 2*(m_mask+1);
+        m_key.assign(capacity, (SEXP)NULL);
+        m_id.assign(capacity, 0);
+        m_mask = capacity-1;
+        for (size_t j=0; j<m_values.size(); ++j) {
+            size_t k = hash(m_values[j]) & m_mask;
+            while (m_key[k] != NULL) k = (k+1) & m_mask;
+            m_key[k] = m_values[j];
+            m_id[k] = (int)j;
+        }
+    }
+
+public:
+    StriCharsxpIds(size_t capacity=1024)  // capacity must be a power of 2
+        : m_key(capacity, (SEXP)NULL), m_id(capacity, 0), m_mask(capacity-1)
+    { }
+
+    R_len_t size() const { return (R_len_t)m_values.size(); }
+
+    SEXP get(R_len_t id) const { return m_values[id]; }
+
+    /** the id of s; a new one if s has not been seen yet */
+    int insert(SEXP s)
+    {
+        size_t k = hash(s) & m_mask;
+        while (m_key[k] != NULL) {
+            if (m_key[k] == s) return m_id[k];
+            k = (k+1) & m_mask;
+        }
+
+        int id = (int)m_values.size();
+        m_key[k] = s;
+        m_id[k] = id;
+        m_values.push_back(s);
+        if (2*m_values.size() > m_mask+1) rehash();
+        return id;
+    }
+};
+
+
+/**
+ * Prepare a character vector with many duplicates for processing
+ * each distinct string once, see STRI__DEDUP_DISPATCH
+ *
+ * Strings are compared by their CHARSXP pointers. The share of
+ * distinct strings is first estimated from an evenly spaced sample
+ * of the elements, so that vectors with few duplicates are given up on
+ * quickly.
+ *
+ * @param x object
+ * @param levels [out] character vector of distinct strings,
+ *    in the order of first appearance
+ * @return R_NilValue if x is not a character vector (without a class
+ *    attribute), is short, or has not enough duplicates;
+ *    otherwise an integer vector of the same length as x,
+ *    giving 0-based indexes into *levels
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri__prepare_arg_string_dedup(SEXP x, SEXP* levels)
+{
+    *levels = R_NilValue;
+    if (!Rf_isString(x) || Rf_isObject(x))
+        return R_NilValue;  // objects are passed to as.character
+
+    R_len_t n = LENGTH(x);
+    if (n < STRI__DEDUP_MIN_LENGTH)
+        return R_NilValue;
+
+    R_len_t nsample = STRI__DEDUP_SAMPLE_SIZE;
+    R_len_t step = n/nsample;
+    StriCharsxpIds sample_ids;
+    for (R_len_t j=0; j<nsample; ++j)
+        sample_ids.insert(STRING_ELT(x, j*step));
+    if (2*sample_ids.size() > nsample)
+        return R_NilValue;  // probably not worth it
+
+    StriCharsxpIds ids;
+    SEXP index;
+    PROTECT(index = Rf_allocVector(INTSXP, n));
+    int* index_tab = INTEGER(index);
+    for (R_len_t i=0; i<n; ++i) {
+        index_tab[i] = ids.insert(STRING_ELT(x, i));
+        if (2*ids.size() > n) {
+            UNPROTECT(1);
+            return R_NilValue;  // the sample was misleading
+        }
+    }
+
+    SEXP uniq;
+    PROTECT(uniq = Rf_allocVector(STRSXP, ids.size()));
+    for (R_len_t k=0; k<ids.size(); ++k)
+        SET_STRING_ELT(uniq, k, ids.get(k));
+
+    UNPROTECT(2);
+    *levels = uniq;
+    return index;
+}
+
+
+/**
+ * Prepare `str` for processing each distinct value once,
+ * see STRI__DEDUP_DISPATCH
+ *
+ * @param x object
+ * @param levels [out] character vector of distinct values
+ * @return R_NilValue if x is neither a plain factor nor a character
+ *    vector with many duplicates; otherwise an integer vector of the
+ *    same length as x, giving 0-based indexes into *levels
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri__prepare_arg_dedup(SEXP x, SEXP* levels)
+{
+    if (Rf_isString(x) && !Rf_isObject(x))
+        return stri__prepare_arg_string_dedup(x, levels);
+    else
+        return stri__prepare_arg_factor(x, levels);
+}
+
+
+/**
+ * Expand a result computed on the distinct values returned by
+ * stri__prepare_arg_dedup, see STRI__DEDUP_DISPATCH
+ *
+ * Character results are not copied: the CHARSXPs are shared.
+ *
+ * @param x logical, integer, double, or character vector
+ *    with one element per distinct value
+ * @param index as returned by stri__prepare_arg_dedup
+ * @return vector of the same type as x, x[index]
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri__dedup_gather(SEXP x, SEXP index)
+{
+    R_len_t n = LENGTH(index);
+    const int* index_tab = INTEGER(index);
+
+    SEXP ret;
+    PROTECT(ret = Rf_allocVector(TYPEOF(x), n));
+    switch (TYPEOF(x)) {
+    case LGLSXP: {
+        const int* x_tab = LOGICAL(x);
+        int* ret_tab = LOGICAL(ret);
+        for (R_len_t i=0; i<n; ++i) ret_tab[i] = x_tab[index_tab[i]];
+        break;
+    }
+    case INTSXP: {
+        const int* x_tab = INTEGER(x);
+        int* ret_tab = INTEGER(ret);
+        for (R_len_t i=0; i<n; ++i) ret_tab[i] = x_tab[index_tab[i]];
+        break;
+    }
+    case REALSXP: {
+        const double* x_tab = REAL(x);
+        double* ret_tab = REAL(ret);
+        for (R_len_t i=0; i<n; ++i) ret_tab[i] = x_tab[index_tab[i]];
+        break;
+    }
+    case STRSXP: {
+        for (R_len_t i=0; i<n; ++i)
+            SET_STRING_ELT(ret, i, STRING_ELT(x, index_tab[i]));
+        break;
+    }
+    default:
+        Rf_error(MSG__INTERNAL_ERROR);  // allowed here
+    }
+    UNPROTECT(1);
+    return ret;
+}
+
+
 /**
  * Prepare character vector argument
  *
@@ -331,12 +661,21 @@ SEXP stri__prepare_arg_list_string(SEXP x, const char* argname)
  *
  * @version 1.6.3 (Marek Gagolewski, 2021-05-20)
  *    allow_error
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    convert plain factors directly, without calling as.character
  */
 SEXP stri__prepare_arg_string(SEXP x, const char* argname, bool allow_error)
 {
     if ((SEXP*)argname == (SEXP*)R_NilValue)
         argname = "<noname>";
 
+    if (stri__is_plain_factor(x)) {
+        SEXP ret = stri__factor_as_character(x);
+        if (!Rf_isNull(ret))
+            return ret;
+    }
+
     if (Rf_isVectorList(x) || Rf_isObject(x))  // factor is an object too
     {
         if (Rf_isVectorList(x) && !stri__check_list_of_scalars(x))
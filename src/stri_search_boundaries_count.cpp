@@ -49,9 +49,14 @@
  *
  * @version 0.4-1 (Marek Gagolewski, 2014-12-02)
  *          use StriRuleBasedBreakIterator
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_count_boundaries(SEXP str, SEXP opts_brkiter)
 {
+    STRI__DEDUP_DISPATCH(str, true,
+        stri_count_boundaries(str, opts_brkiter))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     StriBrkIterOptions opts_brkiter2(opts_brkiter, "line_break");
 
@@ -58,9 +58,14 @@
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_count_charclass(SEXP str, SEXP pattern)
 {
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1,
+        stri_count_charclass(str, pattern))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
     R_len_t vectorize_length =
@@ -69,12 +69,17 @@
  *
  * @version 1.3.1 (Marek Gagolewski, 2019-02-08)
  *    #232: `max_count` arg added
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_detect_charclass(SEXP str, SEXP pattern,
                            SEXP negate, SEXP max_count)
 {
     bool negate_1 = stri__prepare_arg_logical_1_notNA(negate, "negate");
     int max_count_1 = stri__prepare_arg_integer_1_notNA(max_count, "max_count");
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && max_count_1 < 0,
+        stri_detect_charclass(str, pattern, negate, max_count))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
     R_len_t vectorize_length =
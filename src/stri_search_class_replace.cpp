@@ -256,9 +256,14 @@ SEXP stri__replace_all_charclass_no_vectorize_all(SEXP str, SEXP pattern, SEXP r
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-02)
  *          added `vectorize_all` arg
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_replace_all_charclass(SEXP str, SEXP pattern, SEXP replacement, SEXP merge, SEXP vectorize_all)
 {
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(replacement) == 1,
+        stri_replace_all_charclass(str, pattern, replacement, merge, vectorize_all))
     if (stri__prepare_arg_logical_1_notNA(vectorize_all, "vectorize_all"))
         return stri__replace_all_charclass_yes_vectorize_all(str, pattern, replacement, merge);
     else
@@ -387,9 +392,14 @@ SEXP stri__replace_firstlast_charclass(SEXP str, SEXP pattern, SEXP replacement,
  * @return character vector
  *
  * @version 0.1-?? (Marek Gagolewski, 2013-06-06)
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_replace_first_charclass(SEXP str, SEXP pattern, SEXP replacement)
 {
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(replacement) == 1,
+        stri_replace_first_charclass(str, pattern, replacement))
     return stri__replace_firstlast_charclass(str, pattern, replacement, true);
 }
 
@@ -404,8 +414,13 @@ SEXP stri_replace_first_charclass(SEXP str, SEXP pattern, SEXP replacement)
  * @return character vector
  *
  * @version 0.1-?? (Marek Gagolewski, 2013-06-06)
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_replace_last_charclass(SEXP str, SEXP pattern, SEXP replacement)
 {
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(replacement) == 1,
+        stri_replace_last_charclass(str, pattern, replacement))
     return stri__replace_firstlast_charclass(str, pattern, replacement, false);
 }
@@ -51,10 +51,15 @@
  *
  * @version 1.4.7 (Marek Gagolewski, 2020-08-24)
  *    #345: `negate` arg added
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_startswith_charclass(SEXP str, SEXP pattern, SEXP from, SEXP negate)
 {
     bool negate_1 = stri__prepare_arg_logical_1_notNA(negate, "negate");
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(from) == 1,
+        stri_startswith_charclass(str, pattern, from, negate))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
     PROTECT(from = stri__prepare_arg_integer(from, "from"));
@@ -127,10 +132,15 @@ SEXP stri_startswith_charclass(SEXP str, SEXP pattern, SEXP from, SEXP negate)
  *
  * @version 1.4.7 (Marek Gagolewski, 2020-08-24)
  *    #345: `negate` arg added
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_endswith_charclass(SEXP str, SEXP pattern, SEXP to, SEXP negate)
 {
     bool negate_1 = stri__prepare_arg_logical_1_notNA(negate, "negate");
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(to) == 1,
+        stri_endswith_charclass(str, pattern, to, negate))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
     PROTECT(to = stri__prepare_arg_integer(to, "to"));
@@ -32,8 +32,81 @@
 
 #include "stri_stringi.h"
 #include "stri_container_base.h"
-#include "stri_container_utf16.h"
+#include "stri_container_utf16_arena.h"
 #include "stri_container_usearch.h"
+#include "stri_thread.h"
+
+
+/** Does the actual work for stri_count_coll, see stri__parallel_for
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriCountCollWorker {
+
+private:
+
+    StriContainerUTF16_arena& str_cont;  ///< shared, read-only
+    StriContainerUStringSearch* pattern_cont;  ///< a clone in each thread
+    UCollator* collator;  ///< a clone in each thread
+    bool owned;           ///< whether pattern_cont and collator are clones
+    int* ret_tab;
+
+    StriCountCollWorker& operator=(const StriCountCollWorker&);
+
+public:
+
+    StriCountCollWorker(StriContainerUTF16_arena& _str_cont,
+            StriContainerUStringSearch& _pattern_cont, UCollator* _collator,
+            int* _ret_tab)
+        : str_cont(_str_cont), pattern_cont(&_pattern_cont),
+          collator(_collator), owned(false), ret_tab(_ret_tab)
+    { }
+
+    StriCountCollWorker(const StriCountCollWorker& worker)
+        : str_cont(worker.str_cont), pattern_cont(NULL),
+          collator(NULL), owned(true), ret_tab(worker.ret_tab)
+    {
+        collator = stri__ucol_clone(worker.collator);
+        try {
+            pattern_cont = new StriContainerUStringSearch(*worker.pattern_cont, collator);
+        }
+        catch (...) {
+            ucol_close(collator);
+            throw;
+        }
+    }
+
+    ~StriCountCollWorker()
+    {
+        if (owned) {
+            if (pattern_cont) delete pattern_cont;  // must go before collator
+            if (collator) ucol_close(collator);
+        }
+    }
+
+    void operator()(R_len_t from, R_len_t to)
+    {
+        // the same order as in vectorize_next() (matcher reuse)
+        R_len_t n = pattern_cont->get_n();
+        for (R_len_t j = from; j < to && j-from < n; ++j)
+        for (R_len_t i = j; i < to; i += n)
+        {
+            STRI__CONTINUE_ON_EMPTY_OR_NA_STR_PATTERN(str_cont, (*pattern_cont),
+                    ret_tab[i] = NA_INTEGER,
+                    ret_tab[i] = 0)
+
+            UStringSearch *matcher = pattern_cont->getMatcher(i,
+                str_cont.getBuffer(i), str_cont.getLength(i));
+            usearch_reset(matcher);
+            UErrorCode status = U_ZERO_ERROR;
+            R_len_t found = 0;
+            while (!U_FAILURE(status) && ((int)usearch_next(matcher, &status) != USEARCH_DONE))
+                ++found;
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+            ret_tab[i] = found;
+        }
+    }
+};
 
 
 /**
@@ -58,9 +131,17 @@
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriCountCollWorker (multithreading);
+ *    factor-aware dispatch;
+ *    use StriContainerUTF16_arena
  */
 SEXP stri_count_coll(SEXP str, SEXP pattern, SEXP opts_collator)
 {
+    int nthreads = stri__get_num_threads();
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1,
+        stri_count_coll(str, pattern, opts_collator))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
 
@@ -71,30 +152,15 @@ SEXP stri_count_coll(SEXP str, SEXP pattern, SEXP opts_collator)
 
     STRI__ERROR_HANDLER_BEGIN(2)
     R_len_t vectorize_length = stri__recycling_rule(true, 2, LENGTH(str), LENGTH(pattern));
-    StriContainerUTF16 str_cont(str, vectorize_length);
+    StriContainerUTF16_arena str_cont(str, vectorize_length);
     StriContainerUStringSearch pattern_cont(pattern, vectorize_length, collator);  // collator is not owned by pattern_cont
 
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(INTSXP, vectorize_length));
     int* ret_tab = INTEGER(ret);
 
-    for (R_len_t i = pattern_cont.vectorize_init();
-            i != pattern_cont.vectorize_end();
-            i = pattern_cont.vectorize_next(i))
-    {
-        STRI__CONTINUE_ON_EMPTY_OR_NA_STR_PATTERN(str_cont, pattern_cont,
-                ret_tab[i] = NA_INTEGER,
-                ret_tab[i] = 0)
-
-        UStringSearch *matcher = pattern_cont.getMatcher(i, str_cont.get(i));
-        usearch_reset(matcher);
-        UErrorCode status = U_ZERO_ERROR;
-        R_len_t found = 0;
-        while (!U_FAILURE(status) && ((int)usearch_next(matcher, &status) != USEARCH_DONE))
-            ++found;
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-        ret_tab[i] = found;
-    }
+    StriCountCollWorker worker(str_cont, pattern_cont, collator, ret_tab);
+    stri__parallel_for(worker, vectorize_length, nthreads);
 
     if (collator) {
         ucol_close(collator);
@@ -31,11 +31,96 @@
 
 
 #include "stri_stringi.h"
-#include "stri_container_utf16.h"
+#include "stri_container_utf16_arena.h"
 #include "stri_container_usearch.h"
+#include "stri_thread.h"
 #include <unicode/uregex.h>
 
 
+/** Does the actual work for stri_detect_coll, see stri__parallel_for
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriDetectCollWorker {
+
+private:
+
+    StriContainerUTF16_arena& str_cont;  ///< shared, read-only
+    StriContainerUStringSearch* pattern_cont;  ///< a clone in each thread
+    UCollator* collator;  ///< a clone in each thread
+    bool owned;           ///< whether pattern_cont and collator are clones
+    int* ret_tab;
+    bool negate_1;
+    int max_count_1;  ///< must be < 0 if run in many threads
+
+    StriDetectCollWorker& operator=(const StriDetectCollWorker&);
+
+public:
+
+    StriDetectCollWorker(StriContainerUTF16_arena& _str_cont,
+            StriContainerUStringSearch& _pattern_cont, UCollator* _collator,
+            int* _ret_tab, bool _negate_1, int _max_count_1)
+        : str_cont(_str_cont), pattern_cont(&_pattern_cont),
+          collator(_collator), owned(false), ret_tab(_ret_tab),
+          negate_1(_negate_1), max_count_1(_max_count_1)
+    { }
+
+    StriDetectCollWorker(const StriDetectCollWorker& worker)
+        : str_cont(worker.str_cont), pattern_cont(NULL),
+          collator(NULL), owned(true), ret_tab(worker.ret_tab),
+          negate_1(worker.negate_1), max_count_1(worker.max_count_1)
+    {
+        collator = stri__ucol_clone(worker.collator);
+        try {
+            pattern_cont = new StriContainerUStringSearch(*worker.pattern_cont, collator);
+        }
+        catch (...) {
+            ucol_close(collator);
+            throw;
+        }
+    }
+
+    ~StriDetectCollWorker()
+    {
+        if (owned) {
+            if (pattern_cont) delete pattern_cont;  // must go before collator
+            if (collator) ucol_close(collator);
+        }
+    }
+
+    void operator()(R_len_t from, R_len_t to)
+    {
+        // the same order as in vectorize_next() (matcher reuse)
+        R_len_t n = pattern_cont->get_n();
+        for (R_len_t j = from; j < to && j-from < n; ++j)
+        for (R_len_t i = j; i < to; i += n)
+        {
+            if (max_count_1 == 0) {
+                ret_tab[i] = NA_LOGICAL;
+                continue;
+            }
+
+            STRI__CONTINUE_ON_EMPTY_OR_NA_STR_PATTERN(str_cont, (*pattern_cont),
+                    ret_tab[i] = NA_LOGICAL,
+            {   ret_tab[i] = negate_1;
+                if (max_count_1 > 0 && ret_tab[i]) --max_count_1;
+            })
+
+            UErrorCode status;
+            UStringSearch *matcher = pattern_cont->getMatcher(i,
+                str_cont.getBuffer(i), str_cont.getLength(i));
+            usearch_reset(matcher);
+
+            status = U_ZERO_ERROR;
+            ret_tab[i] = ((int)usearch_first(matcher, &status) != USEARCH_DONE);  // this is slow! :-(
+            if (negate_1) ret_tab[i] = !ret_tab[i];
+            if (max_count_1 > 0 && ret_tab[i]) --max_count_1;
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        }
+    }
+};
+
+
 /**
  * Detect if a pattern occurs in a string [with collation]
  *
@@ -66,12 +151,21 @@
  *
  * @version 1.3.1 (Marek Gagolewski, 2019-02-08)
  *    #232: `max_count` arg added
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriDetectCollWorker; multithreading if max_count < 0;
+ *    factor-aware dispatch;
+ *    use StriContainerUTF16_arena
  */
 SEXP stri_detect_coll(SEXP str, SEXP pattern, SEXP negate,
                       SEXP max_count, SEXP opts_collator)
 {
     bool negate_1 = stri__prepare_arg_logical_1_notNA(negate, "negate");
     int max_count_1 = stri__prepare_arg_integer_1_notNA(max_count, "max_count");
+    // max_count requires processing the elements in order
+    int nthreads = (max_count_1 < 0) ? stri__get_num_threads() : 1;
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && max_count_1 < 0,
+        stri_detect_coll(str, pattern, negate, max_count, opts_collator))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
 
@@ -82,41 +176,16 @@ SEXP stri_detect_coll(SEXP str, SEXP pattern, SEXP negate,
 
     STRI__ERROR_HANDLER_BEGIN(2)
     R_len_t vectorize_length = stri__recycling_rule(true, 2, LENGTH(str), LENGTH(pattern));
-    StriContainerUTF16 str_cont(str, vectorize_length);
+    StriContainerUTF16_arena str_cont(str, vectorize_length);
     StriContainerUStringSearch pattern_cont(pattern, vectorize_length, collator);  // collator is not owned by pattern_cont
 
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(LGLSXP, vectorize_length));
     int* ret_tab = LOGICAL(ret);
 
-    for (R_len_t i = pattern_cont.vectorize_init();
-            i != pattern_cont.vectorize_end();
-            i = pattern_cont.vectorize_next(i))
-    {
-        if (max_count_1 == 0) {
-            ret_tab[i] = NA_LOGICAL;
-            continue;
-        }
-
-        STRI__CONTINUE_ON_EMPTY_OR_NA_STR_PATTERN(str_cont, pattern_cont,
-                ret_tab[i] = NA_LOGICAL,
-        {   ret_tab[i] = negate_1;
-            if (max_count_1 > 0 && ret_tab[i]) --max_count_1;
-        })
-
-        UErrorCode status;
-        UStringSearch *matcher = pattern_cont.getMatcher(i, str_cont.get(i));
-        usearch_reset(matcher);
-
-
-
-        status = U_ZERO_ERROR;
-        ret_tab[i] = ((int)usearch_first(matcher, &status) != USEARCH_DONE);  // this is slow! :-(
-        //ret_tab[i] = ((int)usearch_search(matcher, 0, NULL, NULL, &status));  // this is slow! :-(
-        if (negate_1) ret_tab[i] = !ret_tab[i];
-        if (max_count_1 > 0 && ret_tab[i]) --max_count_1;
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-    }
+    StriDetectCollWorker worker(str_cont, pattern_cont, collator,
+        ret_tab, negate_1, max_count_1);
+    stri__parallel_for(worker, vectorize_length, nthreads);
 
     if (collator) {
         ucol_close(collator);
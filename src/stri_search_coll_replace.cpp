@@ -316,9 +316,14 @@ SEXP stri__replace_all_coll_no_vectorize_all(SEXP str, SEXP pattern, SEXP replac
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *          vectorize_all arg added
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_replace_all_coll(SEXP str, SEXP pattern, SEXP replacement, SEXP vectorize_all, SEXP opts_collator)
 {
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(replacement) == 1,
+        stri_replace_all_coll(str, pattern, replacement, vectorize_all, opts_collator))
     if (stri__prepare_arg_logical_1_notNA(vectorize_all, "vectorize_all"))
         return stri__replace_allfirstlast_coll(str, pattern, replacement, opts_collator, 0);
     else
@@ -342,9 +347,14 @@ SEXP stri_replace_all_coll(SEXP str, SEXP pattern, SEXP replacement, SEXP vector
  *
  * @version 0.2-3 (Marek Gagolewski, 2014-05-08)
  *          new fun: stri_replace_last_coll (opts_collator == NA not allowed)
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_replace_last_coll(SEXP str, SEXP pattern, SEXP replacement, SEXP opts_collator)
 {
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(replacement) == 1,
+        stri_replace_last_coll(str, pattern, replacement, opts_collator))
     return stri__replace_allfirstlast_coll(str, pattern, replacement, opts_collator, -1);
 }
 
@@ -365,8 +375,13 @@ SEXP stri_replace_last_coll(SEXP str, SEXP pattern, SEXP replacement, SEXP opts_
  *
  * @version 0.2-3 (Marek Gagolewski, 2014-05-08)
  *          new fun: stri_replace_first_coll (opts_collator == NA not allowed)
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_replace_first_coll(SEXP str, SEXP pattern, SEXP replacement, SEXP opts_collator)
 {
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(replacement) == 1,
+        stri_replace_first_coll(str, pattern, replacement, opts_collator))
     return stri__replace_allfirstlast_coll(str, pattern, replacement, opts_collator, 1);
 }
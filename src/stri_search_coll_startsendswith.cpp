@@ -31,7 +31,7 @@
 
 
 #include "stri_stringi.h"
-#include "stri_container_utf16.h"
+#include "stri_container_utf16_arena.h"
 #include "stri_container_usearch.h"
 #include "stri_container_integer.h"
 
@@ -52,10 +52,16 @@
  *
  * @version 1.4.7 (Marek Gagolewski, 2020-08-24)
  *    #345: `negate` arg added
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch;
+ *    use StriContainerUTF16_arena
  */
 SEXP stri_startswith_coll(SEXP str, SEXP pattern, SEXP from, SEXP negate, SEXP opts_collator)
 {
     bool negate_1 = stri__prepare_arg_logical_1_notNA(negate, "negate");
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(from) == 1,
+        stri_startswith_coll(str, pattern, from, negate, opts_collator))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
     PROTECT(from = stri__prepare_arg_integer(from, "from"));
@@ -66,7 +72,7 @@ SEXP stri_startswith_coll(SEXP str, SEXP pattern, SEXP from, SEXP negate, SEXP o
     STRI__ERROR_HANDLER_BEGIN(3)
     int vectorize_length = stri__recycling_rule(true, 3,
                            LENGTH(str), LENGTH(pattern), LENGTH(from));
-    StriContainerUTF16 str_cont(str, vectorize_length);
+    StriContainerUTF16_arena str_cont(str, vectorize_length);
     StriContainerUStringSearch pattern_cont(pattern, vectorize_length, collator);  // collator is not owned by pattern_cont
     StriContainerInteger from_cont(from, vectorize_length);
 
@@ -87,9 +93,8 @@ SEXP stri_startswith_coll(SEXP str, SEXP pattern, SEXP from, SEXP negate, SEXP o
             continue;
         }
 
-        const UnicodeString* str_cur_data = &(str_cont.get(i));
-        const UChar* str_cur_s = str_cur_data->getBuffer();
-        const int str_cur_n = str_cur_data->length();
+        const UChar* str_cur_s = str_cont.getBuffer(i);
+        const int str_cur_n = str_cont.getLength(i);
 
         R_len_t from_cur = from_cont.get(i);
         if (from_cur == 1)
@@ -146,10 +151,16 @@ SEXP stri_startswith_coll(SEXP str, SEXP pattern, SEXP from, SEXP negate, SEXP o
  *
  * @version 1.4.7 (Marek Gagolewski, 2020-08-24)
  *    #345: `negate` arg added
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch;
+ *    use StriContainerUTF16_arena
  */
 SEXP stri_endswith_coll(SEXP str, SEXP pattern, SEXP to, SEXP negate, SEXP opts_collator)
 {
     bool negate_1 = stri__prepare_arg_logical_1_notNA(negate, "negate");
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(to) == 1,
+        stri_endswith_coll(str, pattern, to, negate, opts_collator))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
     PROTECT(to = stri__prepare_arg_integer(to, "to"));
@@ -160,7 +171,7 @@ SEXP stri_endswith_coll(SEXP str, SEXP pattern, SEXP to, SEXP negate, SEXP opts_
     STRI__ERROR_HANDLER_BEGIN(3)
     int vectorize_length = stri__recycling_rule(true, 3,
                            LENGTH(str), LENGTH(pattern), LENGTH(to));
-    StriContainerUTF16 str_cont(str, vectorize_length);
+    StriContainerUTF16_arena str_cont(str, vectorize_length);
     StriContainerUStringSearch pattern_cont(pattern, vectorize_length, collator);  // collator is not owned by pattern_cont
     StriContainerInteger to_cont(to, vectorize_length);
 
@@ -181,9 +192,8 @@ SEXP stri_endswith_coll(SEXP str, SEXP pattern, SEXP to, SEXP negate, SEXP opts_
             continue;
         }
 
-        const UnicodeString* str_cur_data = &(str_cont.get(i));
-        const UChar* str_cur_s = str_cur_data->getBuffer();
-        const int str_cur_n = str_cur_data->length();
+        const UChar* str_cur_s = str_cont.getBuffer(i);
+        const int str_cur_n = str_cont.getLength(i);
 
         R_len_t to_cur = to_cont.get(i);
         if (to_cur == -1)
@@ -34,6 +34,62 @@
 #include "stri_container_base.h"
 #include "stri_container_utf8.h"
 #include "stri_container_bytesearch.h"
+#include "stri_thread.h"
+
+
+/** Does the actual work for stri_count_fixed, see stri__parallel_for
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriCountFixedWorker {
+
+private:
+
+    StriContainerUTF8& str_cont;  ///< shared, read-only
+    StriContainerByteSearch* pattern_cont;  ///< a clone in each thread
+    bool pattern_cont_owned;
+    int* ret_tab;
+
+    StriCountFixedWorker& operator=(const StriCountFixedWorker&);
+
+public:
+
+    StriCountFixedWorker(StriContainerUTF8& _str_cont,
+            StriContainerByteSearch& _pattern_cont, int* _ret_tab)
+        : str_cont(_str_cont), pattern_cont(&_pattern_cont),
+          pattern_cont_owned(false), ret_tab(_ret_tab)
+    { }
+
+    StriCountFixedWorker(const StriCountFixedWorker& worker)
+        : str_cont(worker.str_cont), pattern_cont(NULL),
+          pattern_cont_owned(true), ret_tab(worker.ret_tab)
+    {
+        pattern_cont = new StriContainerByteSearch(*worker.pattern_cont);
+    }
+
+    ~StriCountFixedWorker()
+    {
+        if (pattern_cont_owned && pattern_cont) delete pattern_cont;
+    }
+
+    void operator()(R_len_t from, R_len_t to)
+    {
+        // the same order as in vectorize_next() (matcher reuse)
+        R_len_t n = pattern_cont->get_n();
+        for (R_len_t j = from; j < to && j-from < n; ++j)
+        for (R_len_t i = j; i < to; i += n)
+        {
+            STRI__CONTINUE_ON_EMPTY_OR_NA_STR_PATTERN(str_cont, (*pattern_cont),
+                    ret_tab[i] = NA_INTEGER, ret_tab[i] = 0)
+
+            StriByteSearchMatcher* matcher = pattern_cont->getMatcher(i, str_cont.get(i));
+            R_len_t found = 0;
+            while (USEARCH_DONE != matcher->findNext())
+                ++found;
+            ret_tab[i] = found;
+        }
+    }
+};
 
 
 /**
@@ -67,10 +123,17 @@
  *
  * @version 0.5-1 (Marek Gagolewski, 2015-02-14)
  *    use StriByteSearchMatcher
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriCountFixedWorker (multithreading);
+ *    factor-aware dispatch
  */
 SEXP stri_count_fixed(SEXP str, SEXP pattern, SEXP opts_fixed)
 {
     uint32_t pattern_flags = StriContainerByteSearch::getByteSearchFlags(opts_fixed, /*allow_overlap*/true);
+    int nthreads = stri__get_num_threads();
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1,
+        stri_count_fixed(str, pattern, opts_fixed))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
 
@@ -83,20 +146,8 @@ SEXP stri_count_fixed(SEXP str, SEXP pattern, SEXP opts_fixed)
     STRI__PROTECT(ret = Rf_allocVector(INTSXP, vectorize_length));
     int* ret_tab = INTEGER(ret);
 
-    for (R_len_t i = pattern_cont.vectorize_init();
-            i != pattern_cont.vectorize_end();
-            i = pattern_cont.vectorize_next(i))
-    {
-        STRI__CONTINUE_ON_EMPTY_OR_NA_STR_PATTERN(str_cont, pattern_cont,
-                ret_tab[i] = NA_INTEGER, ret_tab[i] = 0)
-
-        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i);
-        matcher->reset(str_cont.get(i).c_str(), str_cont.get(i).length());
-        R_len_t found = 0;
-        while (USEARCH_DONE != matcher->findNext())
-            ++found;
-        ret_tab[i] = found;
-    }
+    StriCountFixedWorker worker(str_cont, pattern_cont, ret_tab);
+    stri__parallel_for(worker, vectorize_length, nthreads);
 
     STRI__UNPROTECT_ALL
     return ret;
@@ -33,6 +33,77 @@
 #include "stri_stringi.h"
 #include "stri_container_utf8.h"
 #include "stri_container_bytesearch.h"
+#include "stri_bytesearch_ahocorasick.h"
+#include "stri_thread.h"
+#include <vector>
+#include <algorithm>
+
+
+/** Does the actual work for stri_detect_fixed, see stri__parallel_for
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriDetectFixedWorker {
+
+private:
+
+    StriContainerUTF8& str_cont;  ///< shared, read-only
+    StriContainerByteSearch* pattern_cont;  ///< a clone in each thread
+    bool pattern_cont_owned;
+    int* ret_tab;
+    bool negate_1;
+    int max_count_1;  ///< must be < 0 if run in many threads
+
+    StriDetectFixedWorker& operator=(const StriDetectFixedWorker&);
+
+public:
+
+    StriDetectFixedWorker(StriContainerUTF8& _str_cont,
+            StriContainerByteSearch& _pattern_cont, int* _ret_tab,
+            bool _negate_1, int _max_count_1)
+        : str_cont(_str_cont), pattern_cont(&_pattern_cont),
+          pattern_cont_owned(false), ret_tab(_ret_tab),
+          negate_1(_negate_1), max_count_1(_max_count_1)
+    { }
+
+    StriDetectFixedWorker(const StriDetectFixedWorker& worker)
+        : str_cont(worker.str_cont), pattern_cont(NULL),
+          pattern_cont_owned(true), ret_tab(worker.ret_tab),
+          negate_1(worker.negate_1), max_count_1(worker.max_count_1)
+    {
+        pattern_cont = new StriContainerByteSearch(*worker.pattern_cont);
+    }
+
+    ~StriDetectFixedWorker()
+    {
+        if (pattern_cont_owned && pattern_cont) delete pattern_cont;
+    }
+
+    void operator()(R_len_t from, R_len_t to)
+    {
+        // the same order as in vectorize_next() (matcher reuse)
+        R_len_t n = pattern_cont->get_n();
+        for (R_len_t j = from; j < to && j-from < n; ++j)
+        for (R_len_t i = j; i < to; i += n)
+        {
+            if (max_count_1 == 0) {
+                ret_tab[i] = NA_LOGICAL;
+                continue;
+            }
+
+            STRI__CONTINUE_ON_EMPTY_OR_NA_STR_PATTERN(str_cont, (*pattern_cont),
+                    ret_tab[i] = NA_LOGICAL,
+            {   ret_tab[i] = negate_1;
+                if (max_count_1 > 0 && ret_tab[i]) --max_count_1;
+            })
+
+            StriByteSearchMatcher* matcher = pattern_cont->getMatcher(i, str_cont.get(i));
+            ret_tab[i] = (int)(matcher->findFirst() != USEARCH_DONE);
+            if (negate_1) ret_tab[i] = !ret_tab[i];
+            if (max_count_1 > 0 && ret_tab[i]) --max_count_1;
+        }
+    }
+};
 
 
 /**
@@ -72,6 +143,10 @@
  *
  * @version 1.3.1 (Marek Gagolewski, 2019-02-08)
  *    #232: `max_count` arg added
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriDetectFixedWorker; multithreading if max_count < 0;
+ *    factor-aware dispatch
  */
 SEXP stri_detect_fixed(SEXP str, SEXP pattern, SEXP negate,
                        SEXP max_count, SEXP opts_fixed)
@@ -79,6 +154,10 @@ SEXP stri_detect_fixed(SEXP str, SEXP pattern, SEXP negate,
     bool negate_1 = stri__prepare_arg_logical_1_notNA(negate, "negate");
     int max_count_1 = stri__prepare_arg_integer_1_notNA(max_count, "max_count");
     uint32_t pattern_flags = StriContainerByteSearch::getByteSearchFlags(opts_fixed);
+    // max_count requires processing the elements in order
+    int nthreads = (max_count_1 < 0) ? stri__get_num_threads() : 1;
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && max_count_1 < 0,
+        stri_detect_fixed(str, pattern, negate, max_count, opts_fixed))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
 
@@ -91,27 +170,8 @@ SEXP stri_detect_fixed(SEXP str, SEXP pattern, SEXP negate,
     STRI__PROTECT(ret = Rf_allocVector(LGLSXP, vectorize_length));
     int* ret_tab = LOGICAL(ret);
 
-    for (R_len_t i = pattern_cont.vectorize_init();
-            i != pattern_cont.vectorize_end();
-            i = pattern_cont.vectorize_next(i))
-    {
-        if (max_count_1 == 0) {
-            ret_tab[i] = NA_LOGICAL;
-            continue;
-        }
-
-        STRI__CONTINUE_ON_EMPTY_OR_NA_STR_PATTERN(str_cont, pattern_cont,
-                ret_tab[i] = NA_LOGICAL,
-        {   ret_tab[i] = negate_1;
-            if (max_count_1 > 0 && ret_tab[i]) --max_count_1;
-        })
-
-        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i);
-        matcher->reset(str_cont.get(i).c_str(), str_cont.get(i).length());
-        ret_tab[i] = (int)(matcher->findFirst() != USEARCH_DONE);
-        if (negate_1) ret_tab[i] = !ret_tab[i];
-        if (max_count_1 > 0 && ret_tab[i]) --max_count_1;
-    }
+    StriDetectFixedWorker worker(str_cont, pattern_cont, ret_tab, negate_1, max_count_1);
+    stri__parallel_for(worker, vectorize_length, nthreads);
 
     STRI__UNPROTECT_ALL
     return ret;
@@ -180,3 +240,132 @@ SEXP stri_detect_fixed(SEXP str, SEXP pattern, SEXP negate,
 //      if (utp) { utext_close(utp); utp=NULL; }
 //   })
 }
+
+
+/**
+ * Detect which of the fixed patterns occur in each string
+ *
+ * All the patterns are compiled into a single Aho-Corasick automaton,
+ * so that each string is scanned only once
+ * (case-insensitive search falls back to one pass per pattern).
+ *
+ * @param str character vector
+ * @param pattern character vector; the pattern set
+ * @param mode single string; \code{"any"}, \code{"first"}, or \code{"all"}
+ * @param opts_fixed list
+ * @return logical vector (mode \code{"any"}),
+ *    integer vector with the index of the first matching pattern
+ *    (mode \code{"first"}), or list of integer vectors with the indices
+ *    of all matching patterns (mode \code{"all"})
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri_detect_fixed_any(SEXP str, SEXP pattern, SEXP mode, SEXP opts_fixed)
+{
+    const char* mode_str = stri__prepare_arg_string_1_notNA(mode, "mode");
+    const char* mode_opts[] = {"any", "first", "all", NULL};
+    int mode_cur = stri__match_arg(mode_str, mode_opts);
+    if (mode_cur < 0) Rf_error(MSG__INCORRECT_MATCH_OPTION, "mode");
+
+    uint32_t pattern_flags = StriContainerByteSearch::getByteSearchFlags(opts_fixed);
+    PROTECT(str = stri__prepare_arg_string(str, "str"));
+    PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
+    R_len_t str_n = LENGTH(str);
+    R_len_t pattern_n = LENGTH(pattern);
+
+    STRI__ERROR_HANDLER_BEGIN(2)
+    StriContainerUTF8 str_cont(str, str_n);
+    StriContainerByteSearch pattern_cont(pattern, pattern_n, pattern_flags);
+
+    bool pattern_na = false;
+    for (R_len_t i=0; i<pattern_n; ++i) {
+        if (pattern_cont.isNA(i) || pattern_cont.get(i).length() <= 0)
+            pattern_na = true; // empty pattern: a warning has already been generated
+    }
+
+    // found[j] - indices of the patterns matching str[j] (in increasing order)
+    std::vector< std::vector<R_len_t> > found(str_n);
+    std::vector<bool> any(str_n, false);
+
+    if (!pattern_na && pattern_n > 0 && !pattern_cont.isCaseInsensitive()) {
+        std::vector<const char*> pattern_s(pattern_n);
+        std::vector<R_len_t> pattern_len(pattern_n);
+        for (R_len_t i=0; i<pattern_n; ++i) {
+            pattern_s[i]   = pattern_cont.get(i).c_str();
+            pattern_len[i] = pattern_cont.get(i).length();
+        }
+        StriByteSearchAhoCorasick matcher(&pattern_s[0], &pattern_len[0], pattern_n);
+
+        for (R_len_t j=0; j<str_n; ++j) {
+            if (str_cont.isNA(j) || str_cont.get(j).length() <= 0)
+                continue;
+            matcher.reset(str_cont.get(j).c_str(), str_cont.get(j).length());
+            if (mode_cur == 0)
+                any[j] = matcher.detectAny();
+            else {
+                matcher.detectAll(found[j]);
+                std::sort(found[j].begin(), found[j].end());
+            }
+        }
+    }
+    else if (!pattern_na) {
+        for (R_len_t i=0; i<pattern_n; ++i) {
+            StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i);
+            for (R_len_t j=0; j<str_n; ++j) {
+                if (str_cont.isNA(j) || str_cont.get(j).length() <= 0)
+                    continue;
+                if (mode_cur == 0 && any[j])
+                    continue;
+                if (mode_cur == 1 && !found[j].empty())
+                    continue;
+                matcher->reset(str_cont.get(j).c_str(), str_cont.get(j).length());
+                if (matcher->findFirst() != USEARCH_DONE) {
+                    any[j] = true;
+                    found[j].push_back(i);
+                }
+            }
+        }
+    }
+
+    SEXP ret;
+    if (mode_cur == 0) {
+        STRI__PROTECT(ret = Rf_allocVector(LGLSXP, str_n));
+        int* ret_tab = LOGICAL(ret);
+        for (R_len_t j=0; j<str_n; ++j) {
+            if (str_cont.isNA(j) || pattern_na)
+                ret_tab[j] = NA_LOGICAL;
+            else
+                ret_tab[j] = (int)any[j];
+        }
+    }
+    else if (mode_cur == 1) {
+        STRI__PROTECT(ret = Rf_allocVector(INTSXP, str_n));
+        int* ret_tab = INTEGER(ret);
+        for (R_len_t j=0; j<str_n; ++j) {
+            if (str_cont.isNA(j) || pattern_na || found[j].empty())
+                ret_tab[j] = NA_INTEGER;
+            else
+                ret_tab[j] = found[j][0]+1;
+        }
+    }
+    else {
+        STRI__PROTECT(ret = Rf_allocVector(VECSXP, str_n));
+        for (R_len_t j=0; j<str_n; ++j) {
+            if (str_cont.isNA(j) || pattern_na) {
+                SET_VECTOR_ELT(ret, j, Rf_ScalarInteger(NA_INTEGER));
+                continue;
+            }
+            SEXP cur;
+            STRI__PROTECT(cur = Rf_allocVector(INTSXP, (R_len_t)found[j].size()));
+            int* cur_tab = INTEGER(cur);
+            for (size_t k=0; k<found[j].size(); ++k)
+                cur_tab[k] = found[j][k]+1;
+            SET_VECTOR_ELT(ret, j, cur);
+            STRI__UNPROTECT(1);
+        }
+    }
+
+    STRI__UNPROTECT_ALL
+    return ret;
+    STRI__ERROR_HANDLER_END( ;/* do nothing special on error */ )
+}
@@ -78,8 +78,7 @@ SEXP stri__extract_firstlast_fixed(SEXP str, SEXP pattern, SEXP opts_fixed, bool
         STRI__CONTINUE_ON_EMPTY_OR_NA_STR_PATTERN(str_cont, pattern_cont,
                 SET_STRING_ELT(ret, i, NA_STRING);, SET_STRING_ELT(ret, i, NA_STRING);)
 
-        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i);
-        matcher->reset(str_cont.get(i).c_str(), str_cont.get(i).length());
+        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i, str_cont.get(i));
         int start, len;
         if (first) {
             start = matcher->findFirst();
@@ -186,8 +185,7 @@ SEXP stri_extract_all_fixed(SEXP str, SEXP pattern, SEXP simplify, SEXP omit_no_
                 SET_VECTOR_ELT(ret, i, stri__vector_NA_strings(1));,
                 SET_VECTOR_ELT(ret, i, stri__vector_NA_strings(omit_no_match1?0:1));)
 
-        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i);
-        matcher->reset(str_cont.get(i).c_str(), str_cont.get(i).length());
+        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i, str_cont.get(i));
 
         int start = matcher->findFirst();
         deque< pair<R_len_t, R_len_t> > occurrences;
@@ -97,8 +97,7 @@ SEXP stri__locate_firstlast_fixed(SEXP str, SEXP pattern, SEXP opts_fixed, bool
             { if (get_length1) ret_tab[i] = ret_tab[i+vectorize_length] = -1; }
         )
 
-        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i);
-        matcher->reset(str_cont.get(i).c_str(), str_cont.get(i).length());
+        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i, str_cont.get(i));
         int start;
         if (first) {
             start = matcher->findFirst();
@@ -250,8 +249,7 @@ SEXP stri_locate_all_fixed(SEXP str, SEXP pattern, SEXP omit_no_match, SEXP opts
                 SET_VECTOR_ELT(ret, i, stri__matrix_NA_INTEGER(1, 2));,
                 SET_VECTOR_ELT(ret, i, stri__matrix_NA_INTEGER(omit_no_match1?0:1, 2, get_length1?-1:NA_INTEGER));)
 
-        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i);
-        matcher->reset(str_cont.get(i).c_str(), str_cont.get(i).length());
+        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i, str_cont.get(i));
 
         int start = matcher->findFirst();
         if (start == USEARCH_DONE) { // no matches at all
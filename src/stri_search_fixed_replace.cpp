@@ -33,9 +33,11 @@
 #include "stri_stringi.h"
 #include "stri_container_utf8.h"
 #include "stri_container_bytesearch.h"
+#include "stri_bytesearch_ahocorasick.h"
 #include "stri_string8buf.h"
 //#include "stri_interval.h"
 #include <deque>
+#include <vector>
 //#include <queue>
 //#include <algorithm>
 using namespace std;
@@ -71,10 +73,14 @@ using namespace std;
  *
  * @version 1.0-2 (Marek Gagolewski, 2016-01-30)
  *    Issue #210: Allow NA replacement
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    accept the `simultaneous` option in the replace-all mode
  */
 SEXP stri__replace_allfirstlast_fixed(SEXP str, SEXP pattern, SEXP replacement, SEXP opts_fixed, int type)
 {
-    uint32_t pattern_flags = StriContainerByteSearch::getByteSearchFlags(opts_fixed);
+    uint32_t pattern_flags = StriContainerByteSearch::getByteSearchFlags(opts_fixed,
+        /*allow_overlap*/false, /*allow_simultaneous*/(type == 0));
     PROTECT(str          = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern      = stri__prepare_arg_string(pattern, "pattern"));
     PROTECT(replacement  = stri__prepare_arg_string(replacement, "replacement"));
@@ -98,8 +104,7 @@ SEXP stri__replace_allfirstlast_fixed(SEXP str, SEXP pattern, SEXP replacement,
                 SET_STRING_ELT(ret, i, NA_STRING);,
                 SET_STRING_ELT(ret, i, Rf_mkCharLenCE(NULL, 0, CE_UTF8));)
 
-        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i);
-        matcher->reset(str_cont.get(i).c_str(), str_cont.get(i).length());
+        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i, str_cont.get(i));
         R_len_t start;
         if (type >= 0) { // first or all
             start = matcher->findFirst();
@@ -225,6 +230,103 @@ SEXP stri__replace_allfirstlast_fixed(SEXP str, SEXP pattern, SEXP replacement,
 //}
 
 
+/**
+ * Replace all occurrences of many fixed patterns simultaneously;
+ * vectorize_all=FALSE, simultaneous=TRUE
+ *
+ * Leftmost-longest non-overlapping matches of all the patterns are found
+ * in a single pass through each string (Aho-Corasick); the replacements
+ * are not subject to further substitutions.
+ *
+ * @param str_cont strings
+ * @param pattern_cont patterns (none is NA or empty)
+ * @param replacement_cont replacements, recycled to the number of patterns
+ * @return character vector
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri__replace_all_fixed_simultaneous(StriContainerUTF8& str_cont,
+        StriContainerByteSearch& pattern_cont, StriContainerUTF8& replacement_cont)
+{
+    R_len_t str_n = str_cont.get_n();
+    R_len_t pattern_n = pattern_cont.get_n();
+
+    std::vector<const char*> pattern_s(pattern_n);
+    std::vector<R_len_t> pattern_len(pattern_n);
+    for (R_len_t i=0; i<pattern_n; ++i) {
+        pattern_s[i]   = pattern_cont.get(i).c_str();
+        pattern_len[i] = pattern_cont.get(i).length();
+    }
+    StriByteSearchAhoCorasick matcher(&pattern_s[0], &pattern_len[0], pattern_n);
+
+    SEXP ret;
+    PROTECT(ret = Rf_allocVector(STRSXP, str_n));
+
+    String8buf buf(0);
+    std::vector<R_len_t> which;
+    deque< pair<R_len_t, R_len_t> > occurrences;
+    for (R_len_t j = 0; j<str_n; ++j) {
+        if (str_cont.isNA(j)) {
+            SET_STRING_ELT(ret, j, NA_STRING);
+            continue;
+        }
+
+        occurrences.clear();
+        which.clear();
+        bool is_na = false;
+        R_len_t str_cur_n = str_cont.get(j).length();
+        R_len_t buf_need = str_cur_n;
+        matcher.reset(str_cont.get(j).c_str(), str_cur_n);
+        while (USEARCH_DONE != matcher.findNext()) {
+            R_len_t start = matcher.getMatchedStart();
+            R_len_t i = matcher.getMatchedPattern();
+            if (replacement_cont.isNA(i)) {
+                is_na = true;
+                break;
+            }
+            occurrences.push_back(pair<R_len_t, R_len_t>(start, start+matcher.getMatchedLength()));
+            which.push_back(i);
+            buf_need += replacement_cont.get(i).length()-matcher.getMatchedLength();
+        }
+
+        if (is_na) {
+            SET_STRING_ELT(ret, j, NA_STRING);
+            continue;
+        }
+
+        if (occurrences.empty()) {
+            SET_STRING_ELT(ret, j, str_cont.toR(j));
+            continue;
+        }
+
+        buf.resize(buf_need, false/*destroy contents*/);
+        const char* str_cur_s = str_cont.get(j).c_str();
+        R_len_t buf_used = 0;
+        R_len_t jlast = 0;
+        for (size_t k=0; k<occurrences.size(); ++k) {
+            memcpy(buf.data()+buf_used, str_cur_s+jlast, (size_t)(occurrences[k].first-jlast));
+            buf_used += occurrences[k].first-jlast;
+            const String8& replacement_cur = replacement_cont.get(which[k]);
+            memcpy(buf.data()+buf_used, replacement_cur.c_str(), (size_t)replacement_cur.length());
+            buf_used += replacement_cur.length();
+            jlast = occurrences[k].second;
+        }
+        memcpy(buf.data()+buf_used, str_cur_s+jlast, (size_t)(str_cur_n-jlast));
+        buf_used += str_cur_n-jlast;
+
+#ifndef NDEBUG
+        if (buf_need != buf_used)
+            throw StriException("!NDEBUG: stri__replace_all_fixed_simultaneous: (buf_need != buf_used)");
+#endif
+
+        SET_STRING_ELT(ret, j, Rf_mkCharLenCE(buf.data(), buf_used, CE_UTF8));
+    }
+
+    UNPROTECT(1);
+    return ret;
+}
+
+
 /**
  * Replace all occurrences of a fixed pattern; vectorize_all=FALSE
  *
@@ -246,6 +348,9 @@ SEXP stri__replace_allfirstlast_fixed(SEXP str, SEXP pattern, SEXP replacement,
  *
  * @version 1.0-2 (Marek Gagolewski, 2016-01-30)
  *    Issue #210: Allow NA replacement
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    `simultaneous` option: use stri__replace_all_fixed_simultaneous
  */
 SEXP stri__replace_all_fixed_no_vectorize_all(SEXP str, SEXP pattern, SEXP replacement, SEXP opts_fixed)
 {   // version gamma:
@@ -277,12 +382,35 @@ SEXP stri__replace_all_fixed_no_vectorize_all(SEXP str, SEXP pattern, SEXP repla
         return ret;
     }
 
-    uint32_t pattern_flags = StriContainerByteSearch::getByteSearchFlags(opts_fixed);
+    uint32_t pattern_flags = StriContainerByteSearch::getByteSearchFlags(opts_fixed,
+        /*allow_overlap*/false, /*allow_simultaneous*/true);
 
     STRI__ERROR_HANDLER_BEGIN(3)
-    StriContainerUTF8 str_cont(str, str_n, false); // writable
-    StriContainerUTF8 replacement_cont(replacement, pattern_n);
     StriContainerByteSearch pattern_cont(pattern, pattern_n, pattern_flags);
+    StriContainerUTF8 replacement_cont(replacement, pattern_n);
+
+    if (pattern_cont.isSimultaneous()) {
+        for (R_len_t i = 0; i<pattern_n; ++i) {
+            if (pattern_cont.isNA(i)) {
+                STRI__UNPROTECT_ALL
+                return stri__vector_NA_strings(str_n);
+            }
+            else if (pattern_cont.get(i).length() <= 0) {
+                Rf_warning(MSG__EMPTY_SEARCH_PATTERN_UNSUPPORTED);
+                STRI__UNPROTECT_ALL
+                return stri__vector_NA_strings(str_n);
+            }
+        }
+
+        StriContainerUTF8 str_cont(str, str_n);
+        SEXP ret;
+        STRI__PROTECT(ret = stri__replace_all_fixed_simultaneous(
+            str_cont, pattern_cont, replacement_cont));
+        STRI__UNPROTECT_ALL
+        return ret;
+    }
+
+    StriContainerUTF8 str_cont(str, str_n, false); // writable
 
     for (R_len_t i = 0; i<pattern_n; ++i)
     {
@@ -533,9 +661,14 @@ SEXP stri__replace_all_fixed_no_vectorize_all(SEXP str, SEXP pattern, SEXP repla
  *
  * @version 0.4-1 (Marek Gagolewski, 2014-12-07)
  *    FR #110, #23: opts_fixed arg added
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_replace_all_fixed(SEXP str, SEXP pattern, SEXP replacement, SEXP vectorize_all, SEXP opts_fixed)
 {
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(replacement) == 1,
+        stri_replace_all_fixed(str, pattern, replacement, vectorize_all, opts_fixed))
     if (stri__prepare_arg_logical_1_notNA(vectorize_all, "vectorize_all"))
         return stri__replace_allfirstlast_fixed(str, pattern, replacement, opts_fixed, 0);
     else
@@ -561,9 +694,14 @@ SEXP stri_replace_all_fixed(SEXP str, SEXP pattern, SEXP replacement, SEXP vecto
  *
  * @version 0.4-1 (Marek Gagolewski, 2014-12-07)
  *    FR #110, #23: opts_fixed arg added
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_replace_last_fixed(SEXP str, SEXP pattern, SEXP replacement, SEXP opts_fixed)
 {
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(replacement) == 1,
+        stri_replace_last_fixed(str, pattern, replacement, opts_fixed))
     return stri__replace_allfirstlast_fixed(str, pattern, replacement, opts_fixed, -1);
 }
 
@@ -586,8 +724,13 @@ SEXP stri_replace_last_fixed(SEXP str, SEXP pattern, SEXP replacement, SEXP opts
  *
  * @version 0.4-1 (Marek Gagolewski, 2014-12-07)
  *    FR #110, #23: opts_fixed arg added
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_replace_first_fixed(SEXP str, SEXP pattern, SEXP replacement, SEXP opts_fixed)
 {
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(replacement) == 1,
+        stri_replace_first_fixed(str, pattern, replacement, opts_fixed))
     return stri__replace_allfirstlast_fixed(str, pattern, replacement, opts_fixed, 1);
 }
@@ -140,8 +140,7 @@ SEXP stri_split_fixed(SEXP str, SEXP pattern, SEXP n,
         else if (tokens_only1)
             n_cur++; // we need to do one split ahead here
 
-        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i);
-        matcher->reset(str_cont.get(i).c_str(), str_cont.get(i).length());
+        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i, str_cont.get(i));
         R_len_t k;
         deque< pair<R_len_t, R_len_t> > fields; // byte based-indices
         fields.push_back(pair<R_len_t, R_len_t>(0,0));
@@ -58,11 +58,16 @@
  *
  * @version 1.4.7 (Marek Gagolewski, 2020-08-24)
  *    #345: `negate` arg added
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_startswith_fixed(SEXP str, SEXP pattern, SEXP from, SEXP negate, SEXP opts_fixed)
 {
     bool negate_1 = stri__prepare_arg_logical_1_notNA(negate, "negate");
     uint32_t pattern_flags = StriContainerByteSearch::getByteSearchFlags(opts_fixed);
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(from) == 1,
+        stri_startswith_fixed(str, pattern, from, negate, opts_fixed))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
     PROTECT(from = stri__prepare_arg_integer(from, "from"));
@@ -135,11 +140,16 @@ SEXP stri_startswith_fixed(SEXP str, SEXP pattern, SEXP from, SEXP negate, SEXP
  *
  * @version 1.4.7 (Marek Gagolewski, 2020-08-24)
  *    #345: `negate` arg added
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_endswith_fixed(SEXP str, SEXP pattern, SEXP to, SEXP negate, SEXP opts_fixed)
 {
     bool negate_1 = stri__prepare_arg_logical_1_notNA(negate, "negate");
     uint32_t pattern_flags = StriContainerByteSearch::getByteSearchFlags(opts_fixed);
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(to) == 1,
+        stri_endswith_fixed(str, pattern, to, negate, opts_fixed))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
     PROTECT(to = stri__prepare_arg_integer(to, "to"));
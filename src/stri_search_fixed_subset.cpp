@@ -109,8 +109,7 @@ SEXP stri_subset_fixed(SEXP str, SEXP pattern, SEXP omit_na, SEXP negate, SEXP o
         },
         {which[i] = negate_1; if (which[i]) result_counter++;})
 
-        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i);
-        matcher->reset(str_cont.get(i).c_str(), str_cont.get(i).length());
+        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i, str_cont.get(i));
         which[i] = (int)(matcher->findFirst() != USEARCH_DONE);
         if (negate_1) which[i] = !which[i];
         if (which[i]) result_counter++;
@@ -186,8 +185,7 @@ SEXP stri_subset_fixed_replacement(SEXP str, SEXP pattern, SEXP negate, SEXP opt
         {detected[i] = NA_INTEGER;},
         {detected[i] = negate_1;} )
 
-        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i);
-        matcher->reset(str_cont.get(i).c_str(), str_cont.get(i).length());
+        StriByteSearchMatcher* matcher = pattern_cont.getMatcher(i, str_cont.get(i));
         detected[i] = (((int)(matcher->findFirst() != USEARCH_DONE) && !negate_1) ||
                 ((int)(matcher->findFirst() == USEARCH_DONE) && negate_1));
     }
@@ -30,211 +30,371 @@
  */
 
 
-//// VERSION III: naive O(n*m) - damn slower
-//#include "stri_stringi.h"
-//#include "stri_container_utf8.h"
-//
-//
-///** Value Matching
-// *
-// * @param str character vector
-// * @param table character vector
-// * @nomatch single integer value
-// *
-// * @return integer vector
-// *
-// * @version 0.3-1 (Marek Gagolewski, 2014-06-06)
-// */
-//SEXP stri_in_fixed(SEXP str, SEXP table, SEXP nomatch)
-//{
-//   str = stri__prepare_arg_string(str, "str");
-//   table = stri__prepare_arg_string(table, "table");
-//   nomatch = stri__prepare_arg_integer_1(nomatch, "nomatch");
-//   R_len_t str_length = LENGTH(str);
-//   R_len_t table_length = LENGTH(table);
-//
-//   R_len_t nomatch_cur = INTEGER(nomatch)[0];
-//
-//   STRI__ERROR_HANDLER_BEGIN
-//   StriContainerUTF8 str_cont(str, str_length);
-//   StriContainerUTF8 table_cont(table, table_length);
-//
-//   SEXP ret;
-//   STRI__PROTECT(ret = Rf_allocVector(INTSXP, str_length));
-//   int* ret_tab = INTEGER(ret);
-//
-//   for (R_len_t i = 0; i<str_length; ++i) {
-//      if (str_cont.isNA(i)) {
-//         ret_tab[i] = NA_INTEGER;
-//         continue;
-//      }
-//
-//      const char* str_cur = str_cont.get(i).c_str();
-//
-//      ret_tab[i] = nomatch_cur;
-//      for (int j=0; j<table_length; ++j) {
-//         if (table_cont.isNA(j)) continue;
-//         if (!strcmp(str_cur, table_cont.get(j).c_str())) {
-//            ret_tab[i] = j+1;
-//            break;
-//         }
-//      }
-//
-//      // ... and so on
-//      // it's already slower than match() for n <= 100000
-//
-////      if (it != dict.end())
-////         ret_tab[i] = (*it).second;
-////      else
-////         ret_tab[i] = nomatch_cur;
-//   }
-//
-//   STRI__UNPROTECT_ALL
-//   return ret;
-//   STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
-//}
-
-
-//// VERSION II: sort() table, then (*unfinished*) bin search
-//#include "stri_stringi.h"
-//#include "stri_container_utf8.h"
-//#include <algorithm>
-//#include <vector>
-//
-///** helper struct (comparer) for stri_in_fixed
-// *
-// */
-//struct cmp_str
-//{
-//   StriContainerUTF8* cont;
-//
-//   cmp_str(StriContainerUTF8* _cont) {
-//      cont = _cont;
-//   }
-//
-//   bool operator()(int i, int j)
-//   {
-//      if (cont->isNA(i)) return false;
-//      else if (cont->isNA(j)) return true;
-//      else return strcmp(cont->get(i).c_str(), cont->get(j).c_str()) < 0;
-//   }
-//};
-//
-//
-///** Value Matching
-// *
-// * @param str character vector
-// * @param table character vector
-// * @nomatch single integer value
-// *
-// * @return integer vector
-// *
-// * @version 0.3-1 (Marek Gagolewski, 2014-06-06)
-// */
-//SEXP stri_in_fixed(SEXP str, SEXP table, SEXP nomatch)
-//{
-//   str = stri__prepare_arg_string(str, "str");
-//   table = stri__prepare_arg_string(table, "table");
-//   nomatch = stri__prepare_arg_integer_1(nomatch, "nomatch");
-//   R_len_t str_length = LENGTH(str);
-//   R_len_t table_length = LENGTH(table);
-//
-//   R_len_t nomatch_cur = INTEGER(nomatch)[0];
-//
-//   STRI__ERROR_HANDLER_BEGIN
-//   StriContainerUTF8 str_cont(str, str_length);
-//   StriContainerUTF8 table_cont(table, table_length);
-//
-//   cmp_str comparer(&str_cont);
-//   std::vector<int> idx(table_length);
-//   for (int i=0; i<table_length; ++i) {
-//      idx[i] = i;
-//   }
-//
-//   std::sort(idx.begin(), idx.end(), comparer);
-//
-//   SEXP ret;
-//   STRI__PROTECT(ret = Rf_allocVector(INTSXP, str_length));
-//   int* ret_tab = INTEGER(ret);
-//
-//   for (R_len_t i = 0; i<str_length; ++i) {
-//      if (str_cont.isNA(i)) {
-//         ret_tab[i] = NA_INTEGER;
-//         continue;
-//      }
-//
-//      // ... and so on
-//      // it's already slower than match() for n <= 100000
-//
-////      if (it != dict.end())
-////         ret_tab[i] = (*it).second;
-////      else
-////         ret_tab[i] = nomatch_cur;
-//   }
-//
-//   STRI__UNPROTECT_ALL
-//   return ret;
-//   STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
-//}
-
-
-// // VERSION I: using boost's unordered_map
-//
-//#include "stri_stringi.h"
-//#include "stri_container_utf8.h"
-//#include <boost/unordered/unordered_map.hpp>
-//#include <string>
-//
-//
-///** Value Matching
-// *
-// * @param str character vector
-// * @param table character vector
-// * @nomatch single integer value
-// *
-// * @return integer vector
-// *
-// * @version 0.3-1 (Marek Gagolewski, 2014-06-06)
-// */
-//SEXP stri_in_fixed(SEXP str, SEXP table, SEXP nomatch)
-//{
-//   str = stri__prepare_arg_string(str, "str");
-//   table = stri__prepare_arg_string(table, "table");
-//   nomatch = stri__prepare_arg_integer_1(nomatch, "nomatch");
-//   R_len_t str_length = LENGTH(str);
-//   R_len_t table_length = LENGTH(table);
-//
-//   R_len_t nomatch_cur = INTEGER(nomatch)[0];
-//
-//   STRI__ERROR_HANDLER_BEGIN
-//   StriContainerUTF8 str_cont(str, str_length);
-//   StriContainerUTF8 table_cont(table, table_length);
-//
-//   boost::unordered_map<std::string, R_len_t> dict(table_length);
-//   for (R_len_t i=table_length-1; i>=0; --i) {
-//      if (table_cont.isNA(i)) continue;
-//      dict[std::string(table_cont.get(i).c_str())] = i+1; // 0-based index -> 1-based
-//   }
-//
-//   SEXP ret;
-//   STRI__PROTECT(ret = Rf_allocVector(INTSXP, str_length));
-//   int* ret_tab = INTEGER(ret);
-//
-//   for (R_len_t i = 0; i<str_length; ++i) {
-//      if (str_cont.isNA(i)) {
-//         ret_tab[i] = NA_INTEGER;
-//         continue;
-//      }
-//
-//      std::string str_cur(str_cont.get(i).c_str());
-//      boost::unordered_map<std::string, R_len_t>::iterator it = dict.find(str_cur);
-//      if (it != dict.end())
-//         ret_tab[i] = (*it).second;
-//      else
-//         ret_tab[i] = nomatch_cur;
-//   }
-//
-//   STRI__UNPROTECT_ALL
-//   return ret;
-//   STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
-//}
+
+
+#include "stri_stringi.h"
+#include "stri_container_utf8.h"
+#include "stri_string_index.h"
+#include <vector>
+
+
+/* Value matching
+ *
+ * Prototypes of stri_in_fixed (a naive O(n*m) algorithm, sort+binary
+ * search, and boost's unordered_map) were tested back in 0.3-1 and were
+ * found to be slower than R's match(). Here, an index of `table` is built
+ * once (a hash table of the strings or of their sort keys, see
+ * StriStringIndex) and each element of `str` is looked up
+ * in expected O(1) time. In the collation-based mode, this gives a match()
+ * that respects canonical equivalence, case-insensitive matching, etc.
+ *
+ * The index can also be built once and reused across calls,
+ * see stri_in_index().
+ */
+
+
+/** Constructor
+ *
+ * @param table_cont strings to index
+ * @param table_length length of table
+ * @param col collator or NULL for bytewise comparisons; the index takes
+ *     its ownership, but only if the constructor does not throw
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+StriStringIndex::StriStringIndex(StriContainerUTF8& table_cont,
+    R_len_t table_length, UCollator* col)
+    : m_col(NULL), m_set(col), m_length(table_length), m_firstNA(0)
+{
+    size_t nbytes = 0;
+    R_len_t n = 0;
+    for (R_len_t j=0; j<table_length; ++j) {
+        if (table_cont.isNA(j)) continue;
+        nbytes += table_cont.get(j).length()+1;
+        ++n;
+    }
+
+    m_data.reserve(nbytes);
+    m_offset.reserve(n);
+    m_ascii.reserve(n);
+    std::vector<int> pos;
+    pos.reserve(n);
+    for (R_len_t j=0; j<table_length; ++j) {
+        if (table_cont.isNA(j)) {
+            if (m_firstNA == 0) m_firstNA = j+1;
+            continue;
+        }
+
+        const String8& s = table_cont.get(j);
+        m_offset.push_back(m_data.size());
+        m_data.insert(m_data.end(), s.c_str(), s.c_str()+s.length());
+        m_data.push_back('\0');
+        m_ascii.push_back(s.isASCII());
+        pos.push_back(j+1);
+    }
+
+    // the arena will not be reallocated from now on
+    for (R_len_t k=0; k<n; ++k) {
+        String8 s(m_data.data()+m_offset[k],
+            (R_len_t)(((k+1<n)?m_offset[k+1]:m_data.size())-m_offset[k]-1),
+            /*memalloc*/false, /*killbom*/false, m_ascii[k]);
+        bool inserted;
+        m_set.insert(s, &inserted);
+        if (inserted) m_first.push_back(pos[k]);
+    }
+
+    m_col = col;
+}
+
+
+/** Value matching [internal]
+ *
+ * Missing values in \code{str} are matched against
+ * the first missing value in \code{table} (like in R's match()).
+ *
+ * @param str_cont strings to look up
+ * @param str_length length of str
+ * @param index table index
+ * @param nomatch the value returned if there is no match
+ * @param ret_tab [out] array of size str_length, 1-based indexes
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static void stri__in(StriContainerUTF8& str_cont, R_len_t str_length,
+    StriStringIndex& index, int nomatch, int* ret_tab)
+{
+    for (R_len_t i=0; i<str_length; ++i) {
+        int pos = (str_cont.isNA(i))?index.findNA():index.find(str_cont.get(i));
+        ret_tab[i] = (pos == 0)?nomatch:pos;
+    }
+}
+
+
+/* *************************************************************************
+                                  STRI_IN_INDEX
+   ************************************************************************* */
+
+
+/** Finalizer for the external pointers created by stri_in_index()
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static void stri__in_index_finalizer(SEXP ptr)
+{
+    StriStringIndex* index = (StriStringIndex*)R_ExternalPtrAddr(ptr);
+    if (index) {
+        delete index;
+        R_ClearExternalPtr(ptr);
+    }
+}
+
+
+/** (Re)build the index of a table and attach it to an external pointer
+ *
+ * @param ptr external pointer
+ * @param table character vector, already prepared
+ * @param opts_collator passed to stri__ucol_open()
+ * @param fixed whether to compare strings bytewise
+ *     (opts_collator is ignored then)
+ *
+ * @return ptr, with a finalizer registered
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static SEXP stri__in_index_build(SEXP ptr, SEXP table, SEXP opts_collator, bool fixed)
+{
+    UCollator* col = NULL;
+    if (!fixed)
+        col = stri__ucol_open(opts_collator);
+
+    STRI__ERROR_HANDLER_BEGIN(0)
+    R_len_t table_length = LENGTH(table);
+    StriContainerUTF8 table_cont(table, table_length);
+    R_SetExternalPtrAddr(ptr,
+        (void*)new StriStringIndex(table_cont, table_length, col));
+    col = NULL; // owned by the index now
+
+    // registered here, as deserialised pointers have no finalizers
+    // and are rebuilt via this function too
+    R_RegisterCFinalizerEx(ptr, stri__in_index_finalizer, TRUE);
+
+    STRI__UNPROTECT_ALL
+    return ptr;
+
+    STRI__ERROR_HANDLER_END({
+        if (col) {
+            ucol_close(col);
+            col = NULL;
+        }
+    })
+}
+
+
+/** Get the index stored in an external pointer created by stri_in_index()
+ *
+ * If the pointer is no longer valid (e.g., the object has been
+ * deserialised), the index is rebuilt from the original table.
+ *
+ * WARNING: this function is allowed to call the error() function.
+ * Use before STRI__ERROR_HANDLER_BEGIN (with other prepareargs).
+ *
+ * @param x external pointer
+ * @param collation whether collation-based comparisons are required
+ * @param argname argument name (message formatting)
+ *
+ * @return index
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static StriStringIndex* stri__in_index_get(SEXP x, bool collation, const char* argname)
+{
+    if (TYPEOF(x) != EXTPTRSXP || R_ExternalPtrTag(x) != Rf_install("stri_in_index"))
+        Rf_error(MSG__ARG_EXPECTED_STRING_INDEX, argname); // allowed here
+
+    SEXP prot = R_ExternalPtrProtected(x);
+    bool fixed = (bool)LOGICAL(VECTOR_ELT(prot, 2))[0];
+    if (collation == fixed)
+        Rf_error(MSG__STRING_INDEX_MODE_MISMATCH,
+            argname, fixed?"bytewise":"collation-based"); // allowed here
+
+    if (!R_ExternalPtrAddr(x))
+        stri__in_index_build(x, VECTOR_ELT(prot, 0), VECTOR_ELT(prot, 1), fixed);
+
+    return (StriStringIndex*)R_ExternalPtrAddr(x);
+}
+
+
+/** Create a reusable index of a character vector for value matching
+ *
+ * @param table character vector
+ * @param opts_collator passed to stri__ucol_open()
+ * @param fixed single logical value; whether strings are to be
+ *     compared bytewise
+ *
+ * @return an external pointer with class attribute set
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri_in_index(SEXP table, SEXP opts_collator, SEXP fixed)
+{
+    bool fixed_val = stri__prepare_arg_logical_1_notNA(fixed, "fixed");
+    PROTECT(table = stri__prepare_arg_string(table, "table"));
+
+    // keep everything needed to rebuild the index
+    // (external pointers are not serialised)
+    SEXP prot;
+    PROTECT(prot = Rf_allocVector(VECSXP, 3));
+    SET_VECTOR_ELT(prot, 0, table);
+    SET_VECTOR_ELT(prot, 1, opts_collator);
+    SET_VECTOR_ELT(prot, 2, Rf_ScalarLogical(fixed_val));
+
+    SEXP ret;
+    PROTECT(ret = R_MakeExternalPtr(NULL, Rf_install("stri_in_index"), prot));
+    stri__in_index_build(ret, table, opts_collator, fixed_val);
+    Rf_setAttrib(ret, R_ClassSymbol, Rf_mkString("stri_in_index"));
+
+    UNPROTECT(3);
+    return ret;
+}
+
+
+/** Get basic information on an index created by stri_in_index()
+ *
+ * @param index external pointer
+ *
+ * @return a list
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri_in_index_info(SEXP index)
+{
+    if (TYPEOF(index) != EXTPTRSXP || R_ExternalPtrTag(index) != Rf_install("stri_in_index"))
+        Rf_error(MSG__ARG_EXPECTED_STRING_INDEX, "index");
+    bool fixed = (bool)LOGICAL(VECTOR_ELT(R_ExternalPtrProtected(index), 2))[0];
+    StriStringIndex* cur = stri__in_index_get(index, !fixed, "index");
+
+    SEXP ret, names;
+    PROTECT(ret = Rf_allocVector(VECSXP, 3));
+    SET_VECTOR_ELT(ret, 0, Rf_ScalarInteger(cur->length()));
+    SET_VECTOR_ELT(ret, 1, Rf_ScalarInteger(cur->distinct()));
+    SET_VECTOR_ELT(ret, 2, Rf_ScalarLogical(!cur->isCollationBased()));
+
+    PROTECT(names = Rf_allocVector(STRSXP, 3));
+    SET_STRING_ELT(names, 0, Rf_mkChar("length"));
+    SET_STRING_ELT(names, 1, Rf_mkChar("distinct"));
+    SET_STRING_ELT(names, 2, Rf_mkChar("fixed"));
+    Rf_setAttrib(ret, R_NamesSymbol, names);
+
+    UNPROTECT(2);
+    return ret;
+}
+
+
+/* *************************************************************************
+                                  STRI_IN_*
+   ************************************************************************* */
+
+
+/** Value matching, bytewise
+ *
+ * @param str character vector
+ * @param table character vector or an index created by stri_in_index()
+ * @param nomatch single integer value
+ *
+ * @return integer vector
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri_in_fixed(SEXP str, SEXP table, SEXP nomatch)
+{
+    StriStringIndex* index = NULL;
+    if (TYPEOF(table) == EXTPTRSXP)
+        index = stri__in_index_get(table, false, "table");
+
+    PROTECT(str = stri__prepare_arg_string(str, "str"));
+    if (index)
+        PROTECT(table);
+    else
+        PROTECT(table = stri__prepare_arg_string(table, "table"));
+    int nomatch_cur = stri__prepare_arg_integer_1_NA(nomatch, "nomatch");
+
+    STRI__ERROR_HANDLER_BEGIN(2)
+    R_len_t str_length = LENGTH(str);
+    StriContainerUTF8 str_cont(str, str_length);
+
+    SEXP ret;
+    STRI__PROTECT(ret = Rf_allocVector(INTSXP, str_length));
+    if (index)
+        stri__in(str_cont, str_length, *index, nomatch_cur, INTEGER(ret));
+    else {
+        R_len_t table_length = LENGTH(table);
+        StriContainerUTF8 table_cont(table, table_length);
+        StriStringIndex table_index(table_cont, table_length, NULL);
+        stri__in(str_cont, str_length, table_index, nomatch_cur, INTEGER(ret));
+    }
+
+    STRI__UNPROTECT_ALL
+    return ret;
+    STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
+}
+
+
+/** Value matching, with collation
+ *
+ * @param str character vector
+ * @param table character vector or an index created by stri_in_index()
+ * @param nomatch single integer value
+ * @param opts_collator passed to stri__ucol_open();
+ *     ignored if table is an index
+ *
+ * @return integer vector
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri_in_coll(SEXP str, SEXP table, SEXP nomatch, SEXP opts_collator)
+{
+    StriStringIndex* index = NULL;
+    if (TYPEOF(table) == EXTPTRSXP)
+        index = stri__in_index_get(table, true, "table");
+
+    PROTECT(str = stri__prepare_arg_string(str, "str"));
+    if (index)
+        PROTECT(table);
+    else
+        PROTECT(table = stri__prepare_arg_string(table, "table"));
+    int nomatch_cur = stri__prepare_arg_integer_1_NA(nomatch, "nomatch");
+
+    // call stri__ucol_open after prepare_arg:
+    // if prepare_arg had failed, we would have a mem leak
+    UCollator* col = NULL;
+    if (!index)
+        col = stri__ucol_open(opts_collator);
+    else if (!Rf_isNull(opts_collator))
+        Rf_warning(MSG__ARG_IGNORING, "opts_collator");
+
+    STRI__ERROR_HANDLER_BEGIN(2)
+    R_len_t str_length = LENGTH(str);
+    StriContainerUTF8 str_cont(str, str_length);
+
+    SEXP ret;
+    STRI__PROTECT(ret = Rf_allocVector(INTSXP, str_length));
+    if (index)
+        stri__in(str_cont, str_length, *index, nomatch_cur, INTEGER(ret));
+    else {
+        R_len_t table_length = LENGTH(table);
+        StriContainerUTF8 table_cont(table, table_length);
+        StriStringIndex table_index(table_cont, table_length, col);
+        col = NULL; // owned by table_index now
+        stri__in(str_cont, str_length, table_index, nomatch_cur, INTEGER(ret));
+    }
+
+    STRI__UNPROTECT_ALL
+    return ret;
+
+    STRI__ERROR_HANDLER_END({
+        if (col) {
+            ucol_close(col);
+            col = NULL;
+        }
+    })
+}
@@ -31,8 +31,77 @@
 
 
 #include "stri_stringi.h"
-#include "stri_container_utf16.h"
+#include "stri_container_utf8.h"
 #include "stri_container_regex.h"
+#include "stri_thread.h"
+
+
+/** Does the actual work for stri_count_regex, see stri__parallel_for
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriCountRegexWorker {
+
+private:
+
+    StriContainerUTF8& str_cont;  ///< shared, read-only
+    StriContainerRegexPattern* pattern_cont;  ///< a clone in each thread
+    bool pattern_cont_owned;
+    StriRegexHaystackUTF8 str_text;
+    int* ret_tab;
+
+    StriCountRegexWorker& operator=(const StriCountRegexWorker&);
+
+public:
+
+    StriCountRegexWorker(StriContainerUTF8& _str_cont,
+            StriContainerRegexPattern& _pattern_cont, int* _ret_tab)
+        : str_cont(_str_cont), pattern_cont(&_pattern_cont),
+          pattern_cont_owned(false), ret_tab(_ret_tab)
+    { }
+
+    StriCountRegexWorker(const StriCountRegexWorker& worker)
+        : str_cont(worker.str_cont), pattern_cont(NULL),
+          pattern_cont_owned(true), ret_tab(worker.ret_tab)
+    {
+        pattern_cont = new StriContainerRegexPattern(*worker.pattern_cont);
+    }
+
+    ~StriCountRegexWorker()
+    {
+        if (pattern_cont_owned && pattern_cont) delete pattern_cont;
+    }
+
+    void operator()(R_len_t from, R_len_t to)
+    {
+        // the same order as in vectorize_next() (matcher reuse)
+        R_len_t n = pattern_cont->get_n();
+        for (R_len_t j = from; j < to && j-from < n; ++j)
+        for (R_len_t i = j; i < to; i += n)
+        {
+            STRI__CONTINUE_ON_EMPTY_OR_NA_PATTERN(str_cont, (*pattern_cont),
+                                                  ret_tab[i] = NA_INTEGER)
+
+            RegexMatcher *matcher = pattern_cont->getMatcher(i); // will be deleted automatically
+            if (!pattern_cont->mayMatch(str_cont.get(i))) {
+                ret_tab[i] = 0;
+                continue;
+            }
+
+            str_text.reset(matcher, str_cont.get(i), pattern_cont->isAnchored());
+            UErrorCode status = U_ZERO_ERROR;
+            int count = 0;
+            while (1) {
+                int m_res = (bool)matcher->find(status);
+                STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+                if (!m_res) break;
+
+                ++count;
+            }
+            ret_tab[i] = count;
+        }
+    }
+};
 
 
 /**
@@ -62,9 +131,18 @@
  *
  * @version 1.4.7 (Marek Gagolewski, 2020-08-24)
  *    Use StriContainerRegexPattern::getRegexOptions
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriContainerUTF8 + StriRegexHaystackUTF8 (no UTF-16 copy of `str`);
+ *    reject strings w/o the pattern's required literal before calling ICU;
+ *    use StriCountRegexWorker (multithreading);
+ *    factor-aware dispatch
  */
 SEXP stri_count_regex(SEXP str, SEXP pattern, SEXP opts_regex)
 {
+    int nthreads = stri__get_num_threads();
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1,
+        stri_count_regex(str, pattern, opts_regex))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
     R_len_t vectorize_length = stri__recycling_rule(true, 2, LENGTH(str), LENGTH(pattern));
@@ -73,34 +151,15 @@ SEXP stri_count_regex(SEXP str, SEXP pattern, SEXP opts_regex)
         StriContainerRegexPattern::getRegexOptions(opts_regex);
 
     STRI__ERROR_HANDLER_BEGIN(2)
-    StriContainerUTF16 str_cont(str, vectorize_length);
+    StriContainerUTF8 str_cont(str, vectorize_length);
     StriContainerRegexPattern pattern_cont(pattern, vectorize_length, pattern_opts);
 
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(INTSXP, vectorize_length));
     int* ret_tab = INTEGER(ret);
 
-    for (R_len_t i = pattern_cont.vectorize_init();
-            i != pattern_cont.vectorize_end();
-            i = pattern_cont.vectorize_next(i))
-    {
-        STRI__CONTINUE_ON_EMPTY_OR_NA_PATTERN(str_cont, pattern_cont,
-                                              ret_tab[i] = NA_INTEGER)
-
-        // see search_regex_detect for UText implementation (often slower)
-        RegexMatcher *matcher = pattern_cont.getMatcher(i); // will be deleted automatically
-        matcher->reset(str_cont.get(i));
-        UErrorCode status = U_ZERO_ERROR;
-        int count = 0;
-        while (1) {
-            int m_res = (bool)matcher->find(status);
-            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-            if (!m_res) break;
-
-            ++count;
-        }
-        ret_tab[i] = count;
-    }
+    StriCountRegexWorker worker(str_cont, pattern_cont, ret_tab);
+    stri__parallel_for(worker, vectorize_length, nthreads);
 
     STRI__UNPROTECT_ALL
     return ret;
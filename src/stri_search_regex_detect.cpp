@@ -34,6 +34,81 @@
 #include "stri_container_utf16.h"
 #include "stri_container_utf8.h"
 #include "stri_container_regex.h"
+#include "stri_thread.h"
+
+/** Does the actual work for stri_detect_regex, see stri__parallel_for
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriDetectRegexWorker {
+
+private:
+
+    StriContainerUTF8& str_cont;  ///< shared, read-only
+    StriContainerRegexPattern* pattern_cont;  ///< a clone in each thread
+    bool pattern_cont_owned;
+    StriRegexHaystackUTF8 str_text;
+    int* ret_tab;
+    bool negate_1;
+    int max_count_1;  ///< must be < 0 if run in many threads
+
+    StriDetectRegexWorker& operator=(const StriDetectRegexWorker&);
+
+public:
+
+    StriDetectRegexWorker(StriContainerUTF8& _str_cont,
+            StriContainerRegexPattern& _pattern_cont, int* _ret_tab,
+            bool _negate_1, int _max_count_1)
+        : str_cont(_str_cont), pattern_cont(&_pattern_cont),
+          pattern_cont_owned(false), ret_tab(_ret_tab),
+          negate_1(_negate_1), max_count_1(_max_count_1)
+    { }
+
+    StriDetectRegexWorker(const StriDetectRegexWorker& worker)
+        : str_cont(worker.str_cont), pattern_cont(NULL),
+          pattern_cont_owned(true), ret_tab(worker.ret_tab),
+          negate_1(worker.negate_1), max_count_1(worker.max_count_1)
+    {
+        pattern_cont = new StriContainerRegexPattern(*worker.pattern_cont);
+    }
+
+    ~StriDetectRegexWorker()
+    {
+        if (pattern_cont_owned && pattern_cont) delete pattern_cont;
+    }
+
+    void operator()(R_len_t from, R_len_t to)
+    {
+        // the same order as in vectorize_next() (matcher reuse)
+        R_len_t n = pattern_cont->get_n();
+        for (R_len_t j = from; j < to && j-from < n; ++j)
+        for (R_len_t i = j; i < to; i += n)
+        {
+            if (max_count_1 == 0) {
+                ret_tab[i] = NA_LOGICAL;
+                continue;
+            }
+
+            STRI__CONTINUE_ON_EMPTY_OR_NA_PATTERN(str_cont,
+                                                  (*pattern_cont), ret_tab[i] = NA_LOGICAL)
+
+            RegexMatcher *matcher = pattern_cont->getMatcher(i); // will be deleted automatically
+            if (!pattern_cont->mayMatch(str_cont.get(i)))
+                ret_tab[i] = FALSE;
+            else {
+                str_text.reset(matcher, str_cont.get(i), pattern_cont->isAnchored());
+
+                UErrorCode status = U_ZERO_ERROR;
+                ret_tab[i] = (int)matcher->find(status); // returns UBool
+                STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+            }
+
+            if (negate_1) ret_tab[i] = !ret_tab[i];
+            if (max_count_1 > 0 && ret_tab[i]) --max_count_1;
+        }
+    }
+};
+
 
 /**
  * Detect if a pattern occurs in a string
@@ -69,12 +144,22 @@
  *
  * @version 1.4.7 (Marek Gagolewski, 2020-08-24)
  *    Use StriContainerRegexPattern::getRegexOptions
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriContainerUTF8 + StriRegexHaystackUTF8 (no UTF-16 copy of `str`);
+ *    reject strings w/o the pattern's required literal before calling ICU;
+ *    use StriDetectRegexWorker; multithreading if max_count < 0;
+ *    factor-aware dispatch
  */
 SEXP stri_detect_regex(SEXP str, SEXP pattern, SEXP negate,
                        SEXP max_count, SEXP opts_regex)
 {
     bool negate_1 = stri__prepare_arg_logical_1_notNA(negate, "negate");
     int max_count_1 = stri__prepare_arg_integer_1_notNA(max_count, "max_count");
+    // max_count requires processing the elements in order
+    int nthreads = (max_count_1 < 0) ? stri__get_num_threads() : 1;
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && max_count_1 < 0,
+        stri_detect_regex(str, pattern, negate, max_count, opts_regex))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
     R_len_t vectorize_length =
@@ -84,48 +169,142 @@ SEXP stri_detect_regex(SEXP str, SEXP pattern, SEXP negate,
         StriContainerRegexPattern::getRegexOptions(opts_regex);
 
     STRI__ERROR_HANDLER_BEGIN(2)
-    StriContainerUTF16 str_cont(str, vectorize_length);
-//   StriContainerUTF8 str_cont(str, vectorize_length); // utext_openUTF8, see below
+    StriContainerUTF8 str_cont(str, vectorize_length);
     StriContainerRegexPattern pattern_cont(pattern, vectorize_length, pattern_opts);
 
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(LGLSXP, vectorize_length));
     int* ret_tab = LOGICAL(ret);
 
-    for (R_len_t i = pattern_cont.vectorize_init();
-            i != pattern_cont.vectorize_end();
-            i = pattern_cont.vectorize_next(i))
-    {
-        if (max_count_1 == 0) {
-            ret_tab[i] = NA_LOGICAL;
-            continue;
+    StriDetectRegexWorker worker(str_cont, pattern_cont, ret_tab, negate_1, max_count_1);
+    stri__parallel_for(worker, vectorize_length, nthreads);
+
+    STRI__UNPROTECT_ALL
+    return ret;
+    STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
+}
+
+
+/**
+ * Detect which of many regex patterns (a regex set) match each string
+ *
+ * Each pattern is compiled once; all the patterns are applied on
+ * the same UTF-8 representation of a string (the UTF-16 conversion,
+ * if needed, is performed only once per string).
+ *
+ * @param str R character vector
+ * @param pattern R character vector; the set of regexes
+ * @param mode single string; "any", "first", or "all"
+ * @param opts_regex list
+ * @return logical vector (mode "any"), integer vector (mode "first"),
+ *    or list of integer vectors (mode "all")
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri_detect_regex_any(SEXP str, SEXP pattern, SEXP mode, SEXP opts_regex)
+{
+    const char* mode_str = stri__prepare_arg_string_1_notNA(mode, "mode");
+    const char* mode_opts[] = {"any", "first", "all", NULL};
+    int mode_cur = stri__match_arg(mode_str, mode_opts);
+    if (mode_cur < 0) Rf_error(MSG__INCORRECT_MATCH_OPTION, "mode");
+
+    StriRegexMatcherOptions pattern_opts =
+        StriContainerRegexPattern::getRegexOptions(opts_regex);
+    PROTECT(str = stri__prepare_arg_string(str, "str"));
+    PROTECT(pattern = stri__prepare_arg_string(pattern, "pattern"));
+    R_len_t str_n = LENGTH(str);
+    R_len_t pattern_n = LENGTH(pattern);
+
+    bool pattern_na = false;
+    for (R_len_t i=0; i<pattern_n; ++i) {
+        SEXP cur = STRING_ELT(pattern, i);
+        if (cur == NA_STRING)
+            pattern_na = true;
+        else if (LENGTH(cur) <= 0) {
+            Rf_warning(MSG__EMPTY_SEARCH_PATTERN_UNSUPPORTED);
+            pattern_na = true;
         }
+    }
+    if (pattern_na) pattern_n = 0;  // all results are NA
+
+    // one container per rule, so that each rule keeps its own matcher
+    std::vector<StriContainerRegexPattern*> rules(pattern_n, (StriContainerRegexPattern*)NULL);
 
-        STRI__CONTINUE_ON_EMPTY_OR_NA_PATTERN(str_cont,
-                                              pattern_cont, ret_tab[i] = NA_LOGICAL)
+    STRI__ERROR_HANDLER_BEGIN(2)
+    StriContainerUTF8 str_cont(str, str_n);
+    StriRegexHaystackUTF8 str_text;
+
+    for (R_len_t i=0; i<pattern_n; ++i) {
+        SEXP cur;
+        STRI__PROTECT(cur = Rf_ScalarString(STRING_ELT(pattern, i)));
+        rules[i] = new StriContainerRegexPattern(cur, 1, pattern_opts);
+        rules[i]->getMatcher(0);  // compile now
+        STRI__UNPROTECT(1);
+    }
+
+    SEXP ret;
+    if (mode_cur == 0) {
+        STRI__PROTECT(ret = Rf_allocVector(LGLSXP, str_n));
+    }
+    else if (mode_cur == 1) {
+        STRI__PROTECT(ret = Rf_allocVector(INTSXP, str_n));
+    }
+    else {
+        STRI__PROTECT(ret = Rf_allocVector(VECSXP, str_n));
+    }
 
-        RegexMatcher *matcher = pattern_cont.getMatcher(i); // will be deleted automatically
-        matcher->reset(str_cont.get(i));
+    std::vector<int> found;
+    for (R_len_t j=0; j<str_n; ++j) {
+        if (str_cont.isNA(j) || pattern_na) {
+            if (mode_cur == 0)      LOGICAL(ret)[j] = NA_LOGICAL;
+            else if (mode_cur == 1) INTEGER(ret)[j] = NA_INTEGER;
+            else                    SET_VECTOR_ELT(ret, j, Rf_ScalarInteger(NA_INTEGER));
+            continue;
+        }
 
-        UErrorCode status = U_ZERO_ERROR;
-        ret_tab[i] = (int)matcher->find(status); // returns UBool
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        found.clear();
+        for (R_len_t i=0; i<pattern_n; ++i) {
+            RegexMatcher* matcher = rules[i]->getMatcher(0);  // reused
+            if (!rules[i]->mayMatch(str_cont.get(j)))
+                continue;
+
+            str_text.reset(matcher, str_cont.get(j), rules[i]->isAnchored());
+            UErrorCode status = U_ZERO_ERROR;
+            bool m_res = (bool)matcher->find(status);
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+            if (m_res) {
+                found.push_back(i+1);
+                if (mode_cur != 2) break;  // the first one suffices
+            }
+        }
 
-        if (negate_1) ret_tab[i] = !ret_tab[i];
-        if (max_count_1 > 0 && ret_tab[i]) --max_count_1;
+        if (mode_cur == 0)
+            LOGICAL(ret)[j] = !found.empty();
+        else if (mode_cur == 1)
+            INTEGER(ret)[j] = found.empty()?NA_INTEGER:found[0];
+        else {
+            SEXP cur;
+            STRI__PROTECT(cur = Rf_allocVector(INTSXP, (R_len_t)found.size()));
+            if (!found.empty())
+                memcpy(INTEGER(cur), &found[0], found.size()*sizeof(int));
+            SET_VECTOR_ELT(ret, j, cur);
+            STRI__UNPROTECT(1);
+        }
+    }
 
-//      // mbmark-regex-detect1.R: UTF16 0.07171792 s; UText 0.10531605 s
-//      UText* str_text = NULL;
-//      UErrorCode status = U_ZERO_ERROR;
-//      RegexMatcher *matcher = pattern_cont.getMatcher(i); // will be deleted automatically
-//      str_text = utext_openUTF8(str_text, str_cont.get(i).c_str(), str_cont.get(i).length(), &status);
-//      STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-//      matcher->reset(str_text);
-//      ret_tab[i] = (int)matcher->find(status); // returns UBool
-//      utext_close(str_text);
+    for (R_len_t i=0; i<pattern_n; ++i) {
+        delete rules[i];
+        rules[i] = NULL;
     }
 
     STRI__UNPROTECT_ALL
     return ret;
-    STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
+    STRI__ERROR_HANDLER_END({
+        for (R_len_t i=0; i<pattern_n; ++i) {
+            if (rules[i]) {
+                delete rules[i];
+                rules[i] = NULL;
+            }
+        }
+    })
 }
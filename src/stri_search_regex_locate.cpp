@@ -31,7 +31,7 @@
 
 
 #include "stri_stringi.h"
-#include "stri_container_utf16.h"
+#include "stri_container_utf8.h"
 #include "stri_container_regex.h"
 #include <deque>
 #include <utility>
@@ -42,16 +42,19 @@ using namespace std;
  *
  * does not set dimnames
  *
- * @param i if < 0, then adjust indexes of all is
+ * @param str_text if not NULL, the matches' offsets are converted
+ *    to 1-based code point indexes w.r.t. the current haystack
  *
  * TODO: <refactor> use also in stri_locate_all_fixed etc.
  *
  * @version 1.7.1 (Marek Gagolewski, 2021-06-20)
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriRegexHaystackUTF8 to convert offsets
  */
 SEXP stri__locate_get_fromto_matrix(
     deque< pair<R_len_t, R_len_t> >& occurrences,
-    StriContainerUTF16& str_cont,
-    R_len_t i,
+    StriRegexHaystackUTF8* str_text,
     bool omit_no_match1,
     bool get_length1
 ) {
@@ -73,25 +76,10 @@ SEXP stri__locate_get_fromto_matrix(
         ans_tab[j+noccurrences] = match.second;
     }
 
-    // Adjust UChar index -> UChar32 index
-    // (1-2 byte UTF16 to 1 byte UTF32-code points)
-    if (i < 0) {
-        STRI_ASSERT(noccurrences == str_cont.get_nrecycle());
-        for (i=0; i<noccurrences; ++i) {
-            if (str_cont.isNA(i) || (ans_tab[i] == NA_INTEGER || ans_tab[i] < 0))
-                continue;
-            str_cont.UChar16_to_UChar32_index(
-                i, ans_tab+i,
-                ans_tab+i+noccurrences, 1,
-                1, // 0-based index -> 1-based
-                0  // end returns position of next character after match
-            );
-        }
-    }
-    else {
-        str_cont.UChar16_to_UChar32_index(
-            i, ans_tab,
-            ans_tab+noccurrences, noccurrences,
+    // Adjust UChar/byte index -> UChar32 index
+    if (str_text) {
+        str_text->toUChar32Index(
+            ans_tab, ans_tab+noccurrences, noccurrences,
             1, // 0-based index -> 1-based
             0  // end returns position of next character after match
         );
@@ -143,6 +131,9 @@ SEXP stri__locate_get_fromto_matrix(
  *
  * @version 1.7.1 (Marek Gagolewski, 2021-06-29)
  *     get_length
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriContainerUTF8 + StriRegexHaystackUTF8 (no UTF-16 copy of `str`)
  */
 SEXP stri_locate_all_regex(SEXP str, SEXP pattern, SEXP omit_no_match, SEXP opts_regex, SEXP capture_groups, SEXP get_length)
 {
@@ -156,8 +147,9 @@ SEXP stri_locate_all_regex(SEXP str, SEXP pattern, SEXP omit_no_match, SEXP opts
     R_len_t vectorize_length = stri__recycling_rule(true, 2, LENGTH(str), LENGTH(pattern));
 
     STRI__ERROR_HANDLER_BEGIN(2)
-    StriContainerUTF16 str_cont(str, vectorize_length);
+    StriContainerUTF8 str_cont(str, vectorize_length);
     StriContainerRegexPattern pattern_cont(pattern, vectorize_length, pattern_opts);
+    StriRegexHaystackUTF8 str_text;
 
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(VECSXP, vectorize_length));
@@ -192,7 +184,7 @@ SEXP stri_locate_all_regex(SEXP str, SEXP pattern, SEXP omit_no_match, SEXP opts
             cg_occurrences.resize(pattern_cur_groups);
 
         if (!(str_cont).isNA(i)) {
-            matcher->reset(str_cont.get(i));
+            str_text.reset(matcher, str_cont.get(i), pattern_cont.isAnchored());
             int found = (int)matcher->find(status);
             STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
 
@@ -232,7 +224,7 @@ SEXP stri_locate_all_regex(SEXP str, SEXP pattern, SEXP omit_no_match, SEXP opts
             STRI__PROTECT(ans = stri__matrix_NA_INTEGER(1, 2))
         else
             STRI__PROTECT(ans = stri__locate_get_fromto_matrix(
-                occurrences, str_cont, i,
+                occurrences, &str_text,
                 omit_no_match1, get_length1)
             );
 
@@ -247,7 +239,7 @@ SEXP stri_locate_all_regex(SEXP str, SEXP pattern, SEXP omit_no_match, SEXP opts
                     STRI__PROTECT(ans2 = stri__matrix_NA_INTEGER(1, 2))
                 else
                     STRI__PROTECT(ans2 = stri__locate_get_fromto_matrix(
-                        cg_occurrences[j], str_cont, i, omit_no_match1, get_length1)
+                        cg_occurrences[j], &str_text, omit_no_match1, get_length1)
                     );
                 SET_VECTOR_ELT(cgs, j, ans2);
                 STRI__UNPROTECT(1);
@@ -298,6 +290,9 @@ SEXP stri_locate_all_regex(SEXP str, SEXP pattern, SEXP omit_no_match, SEXP opts
  *
  * @version 1.7.1 (Marek Gagolewski, 2021-06-29)
  *     get_length
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriContainerUTF8 + StriRegexHaystackUTF8 (no UTF-16 copy of `str`)
  */
 SEXP stri__locate_firstlast_regex(
     SEXP str, SEXP pattern, SEXP opts_regex, bool first, bool capture_groups1, bool get_length1
@@ -310,8 +305,9 @@ SEXP stri__locate_firstlast_regex(
         StriContainerRegexPattern::getRegexOptions(opts_regex);
 
     STRI__ERROR_HANDLER_BEGIN(2)
-    StriContainerUTF16 str_cont(str, vectorize_length);
+    StriContainerUTF8 str_cont(str, vectorize_length);
     StriContainerRegexPattern pattern_cont(pattern, vectorize_length, pattern_opts);
+    StriRegexHaystackUTF8 str_text;
 
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocMatrix(INTSXP, vectorize_length, 2));
@@ -360,7 +356,7 @@ SEXP stri__locate_firstlast_regex(
             continue;
         }
 
-        matcher->reset(str_cont.get(i));
+        str_text.reset(matcher, str_cont.get(i), pattern_cont.isAnchored());
 
         UErrorCode status = U_ZERO_ERROR;
         int m_res = (int)matcher->find(status);
@@ -406,14 +402,23 @@ SEXP stri__locate_firstlast_regex(
             if (!m_res) break;
         }
 
-        // Adjust UChar index -> UChar32 index (1-2 byte UTF16 to 1 byte UTF32-code points)
-        str_cont.UChar16_to_UChar32_index(
-            i,
+        // Adjust UChar/byte index -> UChar32 index
+        str_text.toUChar32Index(
             ret_tab+i, ret_tab+i+vectorize_length, 1,
             1, // 0-based index -> 1-based
             0  // end returns position of next character after match
         );
 
+        if (capture_groups1) {
+            for (R_len_t j=0; j<pattern_cur_groups; ++j) {
+                str_text.toUChar32Index(
+                    &cg_occurrences[j][i].first, &cg_occurrences[j][i].second, 1,
+                    1, // 0-based index -> 1-based
+                    0  // end returns position of next character after match
+                );
+            }
+        }
+
         if (get_length1 && ret_tab[i] != NA_INTEGER && ret_tab[i] >= 0)
             ret_tab[i+vectorize_length] -= ret_tab[i] - 1;
 
@@ -427,7 +432,7 @@ SEXP stri__locate_firstlast_regex(
         for (R_len_t j=0; j<pattern_cur_groups; ++j) {
             SEXP ans2;
             STRI__PROTECT(ans2 = stri__locate_get_fromto_matrix(
-                cg_occurrences[j], str_cont, -1, false, get_length1)
+                cg_occurrences[j], NULL, false, get_length1)
             );
             SET_VECTOR_ELT(cgs, j, ans2);
             STRI__UNPROTECT(1);
@@ -290,9 +290,14 @@ SEXP stri__replace_all_regex_no_vectorize_all(SEXP str, SEXP pattern, SEXP repla
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-01)
  *          vectorize_all argument added
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_replace_all_regex(SEXP str, SEXP pattern, SEXP replacement, SEXP vectorize_all, SEXP opts_regex)
 {
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(replacement) == 1,
+        stri_replace_all_regex(str, pattern, replacement, vectorize_all, opts_regex))
     if (stri__prepare_arg_logical_1_notNA(vectorize_all, "vectorize_all"))
         return stri__replace_allfirstlast_regex(str, pattern, replacement, opts_regex, 0);
     else
@@ -310,9 +315,14 @@ SEXP stri_replace_all_regex(SEXP str, SEXP pattern, SEXP replacement, SEXP vecto
  * @return character vector
  *
  * @version 0.1-?? (Marek Gagolewski, 2013-06-21)
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_replace_first_regex(SEXP str, SEXP pattern, SEXP replacement, SEXP opts_regex)
 {
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(replacement) == 1,
+        stri_replace_first_regex(str, pattern, replacement, opts_regex))
     return stri__replace_allfirstlast_regex(str, pattern, replacement, opts_regex, 1);
 }
 
@@ -327,9 +337,14 @@ SEXP stri_replace_first_regex(SEXP str, SEXP pattern, SEXP replacement, SEXP opt
  * @return character vector
  *
  * @version 0.1-?? (Marek Gagolewski, 2013-06-21)
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch
  */
 SEXP stri_replace_last_regex(SEXP str, SEXP pattern, SEXP replacement, SEXP opts_regex)
 {
+    STRI__DEDUP_DISPATCH(str, Rf_length(pattern) == 1 && Rf_length(replacement) == 1,
+        stri_replace_last_regex(str, pattern, replacement, opts_regex))
     return stri__replace_allfirstlast_regex(str, pattern, replacement, opts_regex, -1);
 }
 
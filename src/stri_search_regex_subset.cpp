@@ -30,7 +30,6 @@
  */
 
 #include "stri_stringi.h"
-#include "stri_container_utf16.h"
 #include "stri_container_utf8.h"
 #include "stri_container_regex.h"
 
@@ -66,6 +65,10 @@
  *
  * @version 1.7.1 (Marek Gagolewski, 2021-06-17)
  *    assure LENGTH(pattern) <= LENGTH(str)
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriContainerUTF8 + StriRegexHaystackUTF8 (no UTF-16 copy of `str`);
+ *    reject strings w/o the pattern's required literal before calling ICU
  */
 SEXP stri_subset_regex(SEXP str, SEXP pattern, SEXP omit_na, SEXP negate, SEXP opts_regex)
 {
@@ -89,8 +92,9 @@ SEXP stri_subset_regex(SEXP str, SEXP pattern, SEXP omit_na, SEXP negate, SEXP o
         StriContainerRegexPattern::getRegexOptions(opts_regex);
 
     STRI__ERROR_HANDLER_BEGIN(2)
-    StriContainerUTF16 str_cont(str, vectorize_length);
+    StriContainerUTF8 str_cont(str, vectorize_length);
     StriContainerRegexPattern pattern_cont(pattern, vectorize_length, pattern_opts);
+    StriRegexHaystackUTF8 str_text;
 
     // BT: this cannot be done with deque, because pattern is reused so i does not
     // go like 0,1,2...n but 0,pat_len,2*pat_len,1,pat_len+1 and so on
@@ -110,10 +114,14 @@ SEXP stri_subset_regex(SEXP str, SEXP pattern, SEXP omit_na, SEXP negate, SEXP o
         })
 
         RegexMatcher *matcher = pattern_cont.getMatcher(i); // will be deleted automatically
-        matcher->reset(str_cont.get(i));
-        UErrorCode status = U_ZERO_ERROR;
-        which[i] = (int)matcher->find(status);
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        if (!pattern_cont.mayMatch(str_cont.get(i)))
+            which[i] = FALSE;
+        else {
+            str_text.reset(matcher, str_cont.get(i), pattern_cont.isAnchored());
+            UErrorCode status = U_ZERO_ERROR;
+            which[i] = (int)matcher->find(status);
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        }
         if (negate_1) which[i] = !which[i];
         if (which[i]) result_counter++;
     }
@@ -146,6 +154,9 @@ SEXP stri_subset_regex(SEXP str, SEXP pattern, SEXP omit_na, SEXP negate, SEXP o
  *
  * @version 1.7.1 (Marek Gagolewski, 2021-06-17)
  *    assure LENGTH(pattern) and LENGTH(value) <= LENGTH(str)
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriRegexHaystackUTF8
  */
 SEXP stri_subset_regex_replacement(SEXP str, SEXP pattern, SEXP negate, SEXP opts_regex, SEXP value)
 {
@@ -169,13 +180,13 @@ SEXP stri_subset_regex_replacement(SEXP str, SEXP pattern, SEXP negate, SEXP opt
 
     StriRegexMatcherOptions pattern_opts =
         StriContainerRegexPattern::getRegexOptions(opts_regex);
-    UText* str_text = NULL; // might be slower, but definitely is more convenient!
 
     STRI__ERROR_HANDLER_BEGIN(3)
     R_len_t value_length = LENGTH(value);
     StriContainerUTF8 value_cont(value, value_length);
     StriContainerUTF8 str_cont(str, vectorize_length);
     StriContainerRegexPattern pattern_cont(pattern, vectorize_length, pattern_opts);
+    StriRegexHaystackUTF8 str_text;
 
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(STRSXP, vectorize_length));
@@ -195,9 +206,7 @@ SEXP stri_subset_regex_replacement(SEXP str, SEXP pattern, SEXP negate, SEXP opt
 
         UErrorCode status = U_ZERO_ERROR;
         RegexMatcher *matcher = pattern_cont.getMatcher(i); // will be deleted automatically
-        str_text = utext_openUTF8(str_text, str_cont.get(i).c_str(), str_cont.get(i).length(), &status);
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-        matcher->reset(str_text);
+        str_text.reset(matcher, str_cont.get(i), pattern_cont.isAnchored());
 
         bool found = matcher->find(status);
         STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
@@ -215,17 +224,7 @@ SEXP stri_subset_regex_replacement(SEXP str, SEXP pattern, SEXP negate, SEXP opt
     }
     if ((k % value_length) != 0) Rf_warning(MSG_REPLACEMENT_MULTIPLE);
 
-    if (str_text) {
-        utext_close(str_text);
-        str_text = NULL;
-    }
-
     STRI__UNPROTECT_ALL
     return ret;
-    STRI__ERROR_HANDLER_END({
-        if (str_text) {
-            utext_close(str_text);
-            str_text = NULL;
-        }
-    })
+    STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
 }
@@ -32,14 +32,15 @@
 
 #include "stri_stringi.h"
 #include "stri_container_utf8.h"
-#include "stri_container_utf16.h"
+#include "stri_container_utf16_arena.h"
 #include "stri_string8buf.h"
+#include "stri_sortkey.h"
+#include "stri_thread.h"
 #include <unicode/ucol.h>
 #include <unicode/sortkey.h>
 #include <vector>
 #include <deque>
 #include <algorithm>
-#include <set>
 
 
 # define STRI_SORTRANKORDER_SORT  1
@@ -51,16 +52,25 @@ struct StriSortComparer {
     StriContainerUTF8* cont;
     bool decreasing;
     UCollator* col;
+    const StriCollatorASCII* ascii; // non-NULL if all strings are ASCII
 
-    StriSortComparer(StriContainerUTF8* _cont, UCollator* _col, bool _decreasing)
+    StriSortComparer(StriContainerUTF8* _cont, UCollator* _col, bool _decreasing,
+        const StriCollatorASCII* _ascii=NULL)
     {
         this->cont = _cont;
         this->col = _col;
         this->decreasing = _decreasing;
+        this->ascii = _ascii;
     }
 
     bool operator() (int a, int b) const
     {
+        if (ascii) {
+            int ret = ascii->compare(
+                cont->get(a).c_str(), cont->get(a).length(),
+                cont->get(b).c_str(), cont->get(b).length());
+            return (decreasing)?(ret > 0):(ret < 0);
+        }
 //      if (col) {
         UErrorCode status = U_ZERO_ERROR;
         int ret = (int)ucol_strcollUTF8(col,
@@ -80,6 +90,159 @@ struct StriSortComparer {
 };
 
 
+/** Sort keys and sorted non-NA indices of a chunk of a vector
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+struct StriSortKeysChunk {
+    R_len_t from;            ///< first index in the chunk
+    StriSortKeys keys;       ///< keys of all the chunk's elements
+    std::vector<int> order;  ///< non-NA indices, sorted by their keys
+
+    StriSortKeysChunk(R_len_t _from) : from(_from) { }
+
+    static bool less(const StriSortKeysChunk* a, const StriSortKeysChunk* b) {
+        return a->from < b->from;
+    }
+};
+
+
+/** Sort keys of consecutive chunks of a vector, generated in parallel
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriSortKeysChunks {
+
+private:
+
+    StriLock lock;
+    std::vector<StriSortKeysChunk*> chunks;
+
+    StriSortKeysChunks(const StriSortKeysChunks&); // no copy
+    StriSortKeysChunks& operator=(const StriSortKeysChunks&);
+
+public:
+
+    StriSortKeysChunks() { }
+
+    ~StriSortKeysChunks() {
+        for (size_t c=0; c<chunks.size(); ++c)
+            if (chunks[c]) delete chunks[c];
+    }
+
+    /** the new chunk is owned by this object */
+    StriSortKeysChunk* add(R_len_t from) {
+        StriLockGuard guard(lock);
+        chunks.push_back(NULL);
+        chunks.back() = new StriSortKeysChunk(from);
+        return chunks.back();
+    }
+
+    /** Concatenate all the keys and the chunks' orderings (in order)
+     *  and release the chunks
+     *
+     * @param keys [out] all the keys
+     * @param order [out] non-NA indices, sorted within each chunk
+     * @param runs [out] positions in order where the consecutive chunks start,
+     *     followed by order.size()
+     */
+    void collect(StriSortKeys& keys, std::vector<int>& order,
+        std::vector<R_len_t>& runs)
+    {
+        std::sort(chunks.begin(), chunks.end(), StriSortKeysChunk::less);
+        size_t nbytes = 0;
+        R_len_t nkeys = 0;
+        size_t norder = 0;
+        for (size_t c=0; c<chunks.size(); ++c) {
+            nbytes += chunks[c]->keys.bytes();
+            nkeys += chunks[c]->keys.size();
+            norder += chunks[c]->order.size();
+        }
+        keys.reserve(nkeys, nbytes);
+        order.resize(norder);
+
+        runs.clear();
+        std::vector<int>::iterator out = order.begin();
+        for (size_t c=0; c<chunks.size(); ++c) {
+            runs.push_back((R_len_t)(out-order.begin()));
+            keys.append(chunks[c]->keys);
+            out = std::copy(chunks[c]->order.begin(), chunks[c]->order.end(), out);
+            delete chunks[c];
+            chunks[c] = NULL;
+        }
+        runs.push_back((R_len_t)order.size());
+    }
+};
+
+
+/** Generates the sort keys of a chunk of strings and sorts the chunk's
+ *  non-missing elements (a stri__parallel_for worker)
+ *
+ * Each worker only reads the shared container and writes to its own chunk.
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriSortKeysWorker {
+
+private:
+
+    StriContainerUTF8& str_cont;  ///< shared, read-only
+    UCollator* col;               ///< a clone in each thread
+    bool owned;                   ///< whether col is a clone
+    const StriCollatorASCII* ascii; ///< shared, read-only; may be NULL
+    StriSortKeysChunks& chunks;
+    bool decreasing;
+
+    StriSortKeysWorker& operator=(const StriSortKeysWorker&);
+
+public:
+
+    StriSortKeysWorker(StriContainerUTF8& _str_cont, UCollator* _col,
+            const StriCollatorASCII* _ascii,
+            StriSortKeysChunks& _chunks, bool _decreasing)
+        : str_cont(_str_cont), col(_col), owned(false), ascii(_ascii),
+          chunks(_chunks), decreasing(_decreasing)
+    { }
+
+    StriSortKeysWorker(const StriSortKeysWorker& worker)
+        : str_cont(worker.str_cont), col(NULL), owned(true),
+          ascii(worker.ascii), chunks(worker.chunks),
+          decreasing(worker.decreasing)
+    {
+        if (!ascii) col = stri__ucol_clone(worker.col);
+    }
+
+    ~StriSortKeysWorker()
+    {
+        if (owned && col) ucol_close(col);
+    }
+
+    void operator()(R_len_t from, R_len_t to)
+    {
+        StriSortKeysChunk* chunk = chunks.add(from);
+        StriSortKeys& keys = chunk->keys;
+        std::vector<int>& local = chunk->order;  // relative to from
+        keys.reserve(to-from, 0);
+        local.reserve(to-from);
+        for (R_len_t i=from; i<to; ++i) {
+            if (str_cont.isNA(i)) {
+                keys.push_back_empty();
+                continue;
+            }
+
+            if (ascii)
+                keys.push_back(ascii, str_cont.get(i));
+            else
+                keys.push_back(col, str_cont.get(i));
+            local.push_back(i-from);
+        }
+
+        stri__sortkeys_order(local, keys, decreasing);
+        for (size_t j=0; j<local.size(); ++j) local[j] += from;
+    }
+};
+
+
 /** Sort, rank, or generate an ordering permutation
  *
  * @param str character vector
@@ -115,11 +278,19 @@ struct StriSortComparer {
  *
  * @version 1.6.1 (Marek Gagolewski, 2021-04-30)
  *    rank
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    for vectors of length >= STRI__SORTKEY_MIN_LENGTH, generate
+ *    the sort keys once and sort them via radix sort;
+ *    ties in ranks are determined via key equality;
+ *    multithreaded key generation and sorting (see stri__parallel_for);
+ *    ASCII strings are compared via StriCollatorASCII if possible
  */
 SEXP stri_order_rank_or_sort(SEXP str, SEXP decreasing, SEXP na_last,
                         SEXP opts_collator, int _type)
 {
     bool decr = stri__prepare_arg_logical_1_notNA(decreasing, "decreasing");
+    int nthreads = stri__get_num_threads();
     PROTECT(na_last   = stri__prepare_arg_logical_1(na_last, "na_last"));
     PROTECT(str       = stri__prepare_arg_string(str, "str")); // prepare string argument
     int na_last_int   = INTEGER(na_last)[0];
@@ -162,11 +333,48 @@ SEXP stri_order_rank_or_sort(SEXP str, SEXP decreasing, SEXP na_last,
     order.resize(k); // this should be faster than creating a separate deque (not tested)
 
 
-    // TO DO: collation-based cmp: think of using sort keys...
-    // however,  it's  very fast already now.
+    // ASCII strings can be compared via the collator's weight tables
+    const StriCollatorASCII* ascii = NULL;
+    if (k >= STRI__COLLATOR_ASCII_MIN_LENGTH) {
+        bool all_ascii = true;
+        for (R_len_t j=0; all_ascii && j<k; ++j)
+            all_ascii = str_cont.get(order[j]).isASCII();
+        if (all_ascii)
+            ascii = StriCollatorASCII::get(col);
+    }
 
-    StriSortComparer comp(&str_cont, col, decr);
-    std::stable_sort(order.begin(), order.end(), comp);
+    // for longer vectors, generate the sort keys once;
+    // otherwise, compare the strings directly
+    StriSortKeys keys;
+    bool use_keys = (k >= STRI__SORTKEY_MIN_LENGTH);
+    if (use_keys && nthreads > 1) {
+        // generate the keys of consecutive chunks and sort each chunk
+        // in parallel, then merge the chunks; the result is the same
+        // as in the single-threaded case
+        StriSortKeysChunks chunks;
+        StriSortKeysWorker worker(str_cont, col, ascii, chunks, decr);
+        stri__parallel_for(worker, vectorize_length, nthreads);
+
+        std::vector<R_len_t> runs;
+        chunks.collect(keys, order, runs);
+        stri__sortkeys_merge(order, runs, keys, decr, nthreads);
+    }
+    else if (use_keys) {
+        keys.reserve(vectorize_length, 0);
+        for (R_len_t i=0; i<vectorize_length; ++i) {
+            if (str_cont.isNA(i))
+                keys.push_back_empty();
+            else if (ascii)
+                keys.push_back(ascii, str_cont.get(i));
+            else
+                keys.push_back(col, str_cont.get(i));
+        }
+        stri__sortkeys_order(order, keys, decr);
+    }
+    else {
+        StriSortComparer comp(&str_cont, col, decr, ascii);
+        std::stable_sort(order.begin(), order.end(), comp);
+    }
 
 
     SEXP ret;
@@ -222,7 +430,18 @@ SEXP stri_order_rank_or_sort(SEXP str, SEXP decreasing, SEXP na_last,
         for (std::vector<int>::iterator it=order.begin(); it!=order.end(); ++it) {
             cur_idx = *it;
 
-            if (j_first > 1) {
+            if (j_first > 1 && use_keys) {
+                if (!keys.equal(last_idx, cur_idx))
+                    j_min = j_first;
+                // else reuse j_min == a tie.
+            }
+            else if (j_first > 1 && ascii) {
+                if (0 != ascii->compare(
+                        str_cont.get(last_idx).c_str(), str_cont.get(last_idx).length(),
+                        str_cont.get(cur_idx).c_str(), str_cont.get(cur_idx).length()))
+                    j_min = j_first;
+            }
+            else if (j_first > 1) {
                 UErrorCode status = U_ZERO_ERROR;
                 if (
                     0 != (int)ucol_strcollUTF8(
@@ -264,6 +483,147 @@ SEXP stri_order_rank_or_sort(SEXP str, SEXP decreasing, SEXP na_last,
 
 
 
+/** help struct for stri_order_or_sort_topk: a strict total order
+ *  (ties are resolved by the indices, which makes the order stable) **/
+struct StriTopkComparer {
+    StriContainerUTF8* cont;
+    UCollator* col;
+    const StriCollatorASCII* ascii;  // may be NULL
+    bool decreasing;
+
+    StriTopkComparer(StriContainerUTF8* _cont, UCollator* _col,
+        const StriCollatorASCII* _ascii, bool _decreasing)
+        : cont(_cont), col(_col), ascii(_ascii), decreasing(_decreasing)
+    { }
+
+    bool operator() (int a, int b) const
+    {
+        const String8& sa = cont->get(a);
+        const String8& sb = cont->get(b);
+        int ret;
+        if (ascii && sa.isASCII() && sb.isASCII())
+            ret = ascii->compare(sa.c_str(), sa.length(), sb.c_str(), sb.length());
+        else {
+            UErrorCode status = U_ZERO_ERROR;
+            ret = (int)ucol_strcollUTF8(col, sa.c_str(), sa.length(),
+                sb.c_str(), sb.length(), &status);
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+        }
+        if (ret == 0) return a < b;
+        return (decreasing)?(ret > 0):(ret < 0);
+    }
+};
+
+
+/** Get the first k elements of a sorted vector or of an ordering permutation
+ *
+ * The result is the same as head(stri_sort(...), k) or
+ * head(stri_order(...), k). The strings are scanned once;
+ * the k best ones seen so far are kept in a max-heap
+ * (its top is the worst of them, so most strings are compared
+ * only against it). This takes O(n log k) time and O(k) memory.
+ *
+ * @param str character vector
+ * @param k single nonnegative integer
+ * @param decreasing single logical value
+ * @param na_last single logical value
+ * @param opts_collator passed to stri__ucol_open()
+ * @param _type internal, 1 for sort and 3 for order
+ * @return character or integer vector
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri_order_or_sort_topk(SEXP str, SEXP k, SEXP decreasing, SEXP na_last,
+                        SEXP opts_collator, int _type)
+{
+    bool decr = stri__prepare_arg_logical_1_notNA(decreasing, "decreasing");
+    int k_val = stri__prepare_arg_integer_1_notNA(k, "k");
+    if (k_val < 0)
+        Rf_error(MSG__EXPECTED_NONNEGATIVE);  // error() allowed here
+    PROTECT(na_last   = stri__prepare_arg_logical_1(na_last, "na_last"));
+    PROTECT(str       = stri__prepare_arg_string(str, "str"));
+    int na_last_int   = INTEGER(na_last)[0];
+
+    // type is an internal arg -- check manually
+    if (_type != STRI_SORTRANKORDER_SORT && _type != STRI_SORTRANKORDER_ORDER)
+        Rf_error(MSG__INCORRECT_INTERNAL_ARG);
+
+    UCollator* col = NULL;
+    col = stri__ucol_open(opts_collator);
+
+    STRI__ERROR_HANDLER_BEGIN(2)
+
+    R_len_t vectorize_length = LENGTH(str);
+    StriContainerUTF8 str_cont(str, vectorize_length);
+
+    const StriCollatorASCII* ascii = NULL;
+    if (vectorize_length >= STRI__COLLATOR_ASCII_MIN_LENGTH)
+        ascii = StriCollatorASCII::get(col);
+
+    StriTopkComparer comp(&str_cont, col, ascii, decr);
+    std::vector<int> heap;     // at most k non-NA indices
+    std::vector<int> NA_pos;   // at most k NA indices
+    heap.reserve((k_val < vectorize_length)?k_val:vectorize_length);
+    for (R_len_t i=0; i<vectorize_length; ++i) {
+        if (str_cont.isNA(i)) {
+            if (na_last_int != NA_LOGICAL && (R_len_t)NA_pos.size() < k_val)
+                NA_pos.push_back(i);
+        }
+        else if ((R_len_t)heap.size() < k_val) {
+            heap.push_back(i);
+            std::push_heap(heap.begin(), heap.end(), comp);
+        }
+        else if (k_val > 0 && comp(i, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), comp);
+            heap.back() = i;
+            std::push_heap(heap.begin(), heap.end(), comp);
+        }
+    }
+    std::sort_heap(heap.begin(), heap.end(), comp);
+
+    // merge with the NAs
+    std::vector<int> res;
+    res.reserve(heap.size()+NA_pos.size());
+    if (na_last_int != NA_LOGICAL && !na_last_int)
+        res.insert(res.end(), NA_pos.begin(), NA_pos.end());
+    res.insert(res.end(), heap.begin(), heap.end());
+    if (na_last_int != NA_LOGICAL && na_last_int)
+        res.insert(res.end(), NA_pos.begin(), NA_pos.end());
+    if ((R_len_t)res.size() > k_val)
+        res.resize(k_val);
+
+    SEXP ret;
+    R_len_t nret = (R_len_t)res.size();
+    if (_type == STRI_SORTRANKORDER_SORT) {
+        STRI__PROTECT(ret = Rf_allocVector(STRSXP, nret));
+        for (R_len_t j=0; j<nret; ++j)
+            SET_STRING_ELT(ret, j, str_cont.isNA(res[j])?NA_STRING:str_cont.toR(res[j]));
+    }
+    else {
+        STRI__PROTECT(ret = Rf_allocVector(INTSXP, nret));
+        int* ret_tab = INTEGER(ret);
+        for (R_len_t j=0; j<nret; ++j)
+            ret_tab[j] = res[j]+1; // 1-based indices
+    }
+
+    if (col) {
+        ucol_close(col);
+        col = NULL;
+    }
+
+    STRI__UNPROTECT_ALL
+    return ret;
+
+    STRI__ERROR_HANDLER_END({
+        if (col) {
+            ucol_close(col);
+            col = NULL;
+        }
+    })
+}
+
+
+
 
 /** Sort a character vector
  *
@@ -300,6 +660,40 @@ SEXP stri_order(SEXP str, SEXP decreasing, SEXP na_last, SEXP opts_collator)
 }
 
 
+/** Get the first k elements of a sorted character vector
+ *
+ * @param str character vector
+ * @param k single nonnegative integer
+ * @param decreasing single logical value
+ * @param na_last single logical value
+ * @param opts_collator passed to stri__ucol_open()
+ * @return character vector
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri_sort_topk(SEXP str, SEXP k, SEXP decreasing, SEXP na_last, SEXP opts_collator)
+{
+    return stri_order_or_sort_topk(str, k, decreasing, na_last, opts_collator, STRI_SORTRANKORDER_SORT);
+}
+
+
+/** Get the first k elements of an ordering permutation
+ *
+ * @param str character vector
+ * @param k single nonnegative integer
+ * @param decreasing single logical value
+ * @param na_last single logical value
+ * @param opts_collator passed to stri__ucol_open()
+ * @return integer vector
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri_order_topk(SEXP str, SEXP k, SEXP decreasing, SEXP na_last, SEXP opts_collator)
+{
+    return stri_order_or_sort_topk(str, k, decreasing, na_last, opts_collator, STRI_SORTRANKORDER_ORDER);
+}
+
+
 /** Rank strings
  *
  * @param str character vector
@@ -333,6 +727,9 @@ SEXP stri_rank(SEXP str, SEXP opts_collator)
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriSortKeyHashSet instead of std::set
  */
 SEXP stri_unique(SEXP str, SEXP opts_collator)
 {
@@ -348,8 +745,7 @@ SEXP stri_unique(SEXP str, SEXP opts_collator)
     R_len_t vectorize_length = LENGTH(str);
     StriContainerUTF8 str_cont(str, vectorize_length);
 
-    StriSortComparer comp(&str_cont, col, true);
-    set<int,StriSortComparer> uniqueset(comp);
+    StriSortKeyHashSet uniqueset(col);
 
     bool was_na = false;
     deque<SEXP> temp;
@@ -361,8 +757,9 @@ SEXP stri_unique(SEXP str, SEXP opts_collator)
             }
         }
         else {
-            pair<set<int,StriSortComparer>::iterator,bool> result = uniqueset.insert(i);
-            if (result.second) {
+            bool inserted;
+            uniqueset.insert(str_cont.get(i), &inserted);
+            if (inserted) {
                 temp.push_back(str_cont.toR(i));
             }
         }
@@ -406,6 +803,9 @@ SEXP stri_unique(SEXP str, SEXP opts_collator)
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriSortKeyHashSet instead of std::set
  */
 SEXP stri_duplicated(SEXP str, SEXP fromLast, SEXP opts_collator)
 {
@@ -422,8 +822,7 @@ SEXP stri_duplicated(SEXP str, SEXP fromLast, SEXP opts_collator)
     R_len_t vectorize_length = LENGTH(str);
     StriContainerUTF8 str_cont(str, vectorize_length);
 
-    StriSortComparer comp(&str_cont, col, true);
-    set<int,StriSortComparer> uniqueset(comp);
+    StriSortKeyHashSet uniqueset(col);
 
     bool was_na = false;
     SEXP ret;
@@ -438,8 +837,9 @@ SEXP stri_duplicated(SEXP str, SEXP fromLast, SEXP opts_collator)
                     was_na = true;
             }
             else {
-                pair<set<int,StriSortComparer>::iterator,bool> result = uniqueset.insert(i);
-                ret_tab[i] = !result.second;
+                bool inserted;
+                uniqueset.insert(str_cont.get(i), &inserted);
+                ret_tab[i] = !inserted;
             }
         }
     }
@@ -451,8 +851,9 @@ SEXP stri_duplicated(SEXP str, SEXP fromLast, SEXP opts_collator)
                     was_na = true;
             }
             else {
-                pair<set<int,StriSortComparer>::iterator,bool> result = uniqueset.insert(i);
-                ret_tab[i] = !result.second;
+                bool inserted;
+                uniqueset.insert(str_cont.get(i), &inserted);
+                ret_tab[i] = !inserted;
             }
         }
     }
@@ -489,6 +890,9 @@ SEXP stri_duplicated(SEXP str, SEXP fromLast, SEXP opts_collator)
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriSortKeyHashSet instead of std::set
  */
 SEXP stri_duplicated_any(SEXP str, SEXP fromLast, SEXP opts_collator)
 {
@@ -505,8 +909,7 @@ SEXP stri_duplicated_any(SEXP str, SEXP fromLast, SEXP opts_collator)
     R_len_t vectorize_length = LENGTH(str);
     StriContainerUTF8 str_cont(str, vectorize_length);
 
-    StriSortComparer comp(&str_cont, col, true);
-    set<int,StriSortComparer> uniqueset(comp);
+    StriSortKeyHashSet uniqueset(col);
 
     bool was_na = false;
     SEXP ret;
@@ -525,8 +928,9 @@ SEXP stri_duplicated_any(SEXP str, SEXP fromLast, SEXP opts_collator)
                 }
             }
             else {
-                pair<set<int,StriSortComparer>::iterator,bool> result = uniqueset.insert(i);
-                if (!result.second) {
+                bool inserted;
+                uniqueset.insert(str_cont.get(i), &inserted);
+                if (!inserted) {
                     ret_tab[0] = i+1;
                     break;
                 }
@@ -544,8 +948,9 @@ SEXP stri_duplicated_any(SEXP str, SEXP fromLast, SEXP opts_collator)
                 }
             }
             else {
-                pair<set<int,StriSortComparer>::iterator,bool> result = uniqueset.insert(i);
-                if (!result.second) {
+                bool inserted;
+                uniqueset.insert(str_cont.get(i), &inserted);
+                if (!inserted) {
                     ret_tab[0] = i+1;
                     break;
                 }
@@ -571,6 +976,110 @@ SEXP stri_duplicated_any(SEXP str, SEXP fromLast, SEXP opts_collator)
 }
 
 
+/** Group equivalent strings (a factor under collation-based equality)
+ *
+ * A single pass over the strings assigns each one the id of its
+ * equivalence class via StriSortKeyHashSet (as in stri_unique and
+ * stri_duplicated, the sort key of each distinct string is generated
+ * only once); the first string in each class becomes its level.
+ *
+ * @param str character vector
+ * @param sort single logical value; whether the levels should be
+ *     sorted (otherwise they are given in the order of first appearance)
+ * @param opts_collator passed to stri__ucol_open()
+ * @return a factor (integer vector of codes, NA for NA,
+ *     with attributes levels and class)
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri_group(SEXP str, SEXP sort, SEXP opts_collator)
+{
+    bool sort_val = stri__prepare_arg_logical_1_notNA(sort, "sort");
+    PROTECT(str = stri__prepare_arg_string(str, "str")); // prepare string argument
+
+    // call stri__ucol_open after prepare_arg:
+    // if prepare_arg had failed, we would have a mem leak
+    UCollator* col = NULL;
+    col = stri__ucol_open(opts_collator);
+
+    STRI__ERROR_HANDLER_BEGIN(1)
+
+    R_len_t vectorize_length = LENGTH(str);
+    StriContainerUTF8 str_cont(str, vectorize_length);
+
+    StriSortKeyHashSet groups(col);
+    std::vector<int> first;  // index of the first element of each class
+
+    SEXP ret;
+    STRI__PROTECT(ret = Rf_allocVector(INTSXP, vectorize_length));
+    int* ret_tab = INTEGER(ret);
+    for (R_len_t i=0; i<vectorize_length; ++i) {
+        if (str_cont.isNA(i)) {
+            ret_tab[i] = NA_INTEGER;
+            continue;
+        }
+
+        bool inserted;
+        ret_tab[i] = groups.insert(str_cont.get(i), &inserted)+1;
+        if (inserted)
+            first.push_back(i);
+    }
+
+    R_len_t nlevels = (R_len_t)first.size();
+    std::vector<int> level_order(nlevels); // class ids, in the order of levels
+    for (R_len_t j=0; j<nlevels; ++j)
+        level_order[j] = j;
+
+    if (sort_val && nlevels > 1) {
+        // the classes are pairwise distinct: there are no ties
+        if (nlevels >= STRI__SORTKEY_MIN_LENGTH) {
+            StriSortKeys keys;
+            keys.reserve(nlevels, 0);
+            for (R_len_t j=0; j<nlevels; ++j)
+                keys.push_back(col, str_cont.get(first[j]));
+            stri__sortkeys_order(level_order, keys, false);
+        }
+        else {
+            std::vector<int> sorted(first);
+            StriSortComparer comp(&str_cont, col, false);
+            std::stable_sort(sorted.begin(), sorted.end(), comp);
+            for (R_len_t j=0; j<nlevels; ++j)
+                level_order[j] = ret_tab[sorted[j]]-1;
+        }
+
+        std::vector<int> new_code(nlevels);
+        for (R_len_t j=0; j<nlevels; ++j)
+            new_code[level_order[j]] = j+1;
+        for (R_len_t i=0; i<vectorize_length; ++i) {
+            if (ret_tab[i] != NA_INTEGER)
+                ret_tab[i] = new_code[ret_tab[i]-1];
+        }
+    }
+
+    SEXP levels;
+    STRI__PROTECT(levels = Rf_allocVector(STRSXP, nlevels));
+    for (R_len_t j=0; j<nlevels; ++j)
+        SET_STRING_ELT(levels, j, str_cont.toR(first[level_order[j]]));
+    Rf_setAttrib(ret, R_LevelsSymbol, levels);
+    Rf_setAttrib(ret, R_ClassSymbol, Rf_mkString("factor"));
+
+    if (col) {
+        ucol_close(col);
+        col = NULL;
+    }
+
+    STRI__UNPROTECT_ALL
+    return ret;
+
+    STRI__ERROR_HANDLER_END({
+        if (col) {
+            ucol_close(col);
+            col = NULL;
+        }
+    })
+}
+
+
 /** Compute a character sort key
  *
  * @param str character vector
@@ -580,6 +1089,9 @@ SEXP stri_duplicated_any(SEXP str, SEXP fromLast, SEXP opts_collator)
  * @version 1.4.7 (Davis Vaughan, 2020-07-15)
  * @version 1.6.1 (Marek Gagolewski, 2021-04-29)
  *          output `bytes`-encoded strings
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    use StriContainerUTF16_arena
  */
 SEXP stri_sort_key(SEXP str, SEXP opts_collator) {
     PROTECT(str = stri__prepare_arg_string(str, "str"));
@@ -591,7 +1103,7 @@ SEXP stri_sort_key(SEXP str, SEXP opts_collator) {
     STRI__ERROR_HANDLER_BEGIN(1)
 
     R_len_t length = LENGTH(str);
-    StriContainerUTF16 str_cont(str, length);
+    StriContainerUTF16_arena str_cont(str, length);
 
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(STRSXP, length));
@@ -609,9 +1121,8 @@ SEXP stri_sort_key(SEXP str, SEXP opts_collator) {
             continue;
         }
 
-        const UnicodeString* p_str_cur_data = &(str_cont.get(i));
-        const UChar* p_str_cur = p_str_cur_data->getBuffer();
-        const int str_cur_length = p_str_cur_data->length();
+        const UChar* p_str_cur = str_cont.getBuffer(i);
+        const int str_cur_length = str_cont.getLength(i);
 
         int32_t key_size = ucol_getSortKey(col, p_str_cur, str_cur_length, p_key_buffer_u8, key_buffer_size);
 
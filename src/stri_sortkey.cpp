@@ -0,0 +1,509 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+#include "stri_stringi.h"
+#include "stri_sortkey.h"
+#include "stri_thread.h"
+#include <unicode/ustring.h>
+#include <algorithm>
+
+
+/** Generate the sort key of a string
+ *
+ * @param col collator
+ * @param s UTF-8 string, not NA
+ * @param buf UTF-16 conversion buffer
+ * @param out [out] the key is written at out[off], without the trailing NUL;
+ *     out is resized accordingly
+ * @param off offset in out
+ * @return key length in bytes
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+size_t stri__sortkey_generate(UCollator* col, const String8& s,
+    std::vector<UChar>& buf, std::vector<uint8_t>& out, size_t off)
+{
+    const char* str = s.c_str();
+    R_len_t n = s.length();
+
+    if ((R_len_t)buf.size() < n+1) buf.resize(n+1);  // #UChars <= #bytes
+    int32_t blen = 0;
+    if (s.isASCII()) {
+        for (R_len_t j=0; j<n; ++j)
+            buf[j] = (UChar)(unsigned char)str[j];
+        blen = n;
+    }
+    else {
+        UErrorCode status = U_ZERO_ERROR;
+        u_strFromUTF8WithSub(&buf[0], n+1, &blen, str, n, 0xfffd, NULL, &status);
+        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+    }
+
+    // a first guess; sort keys are usually not longer than that
+    int32_t cap = 3*blen+32;
+    out.resize(off+cap);
+    int32_t klen = ucol_getSortKey(col, &buf[0], blen, out.data()+off, cap);
+    if (klen > cap) {
+        // try again with a larger buffer
+        cap = klen;
+        out.resize(off+cap);
+        klen = ucol_getSortKey(col, &buf[0], blen, out.data()+off, cap);
+    }
+    if (klen <= 0 || klen > cap)
+        throw StriException(MSG__INTERNAL_ERROR);
+
+    // drop the trailing NUL
+    out.resize(off+klen-1);
+    return (size_t)(klen-1);
+}
+
+
+/** Generate the sort key of a string and append it to the arena
+ *
+ * @param col collator
+ * @param s UTF-8 string, not NA
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriSortKeys::push_back(UCollator* col, const String8& s)
+{
+    size_t off = m_data.size();
+    size_t klen = stri__sortkey_generate(col, s, m_buf, m_data, off);
+    m_offset.push_back(off+klen);
+}
+
+
+/** Append the key of an ASCII string generated via weight tables
+ *
+ * Such keys must not be mixed with the ones generated by ICU.
+ *
+ * @param ascii weight tables
+ * @param s ASCII string, not NA
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriSortKeys::push_back(const StriCollatorASCII* ascii, const String8& s)
+{
+    size_t off = m_data.size();
+    size_t klen = ascii->sortkey(s.c_str(), s.length(), m_data, off);
+    m_offset.push_back(off+klen);
+}
+
+
+/** Append an empty key (for a missing value)
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriSortKeys::push_back_empty()
+{
+    m_offset.push_back(m_data.size());
+}
+
+
+/** Append all the keys from another arena
+ *
+ * @param other the keys to copy
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriSortKeys::append(const StriSortKeys& other)
+{
+    size_t off = m_data.size();
+    m_data.insert(m_data.end(), other.m_data.begin(), other.m_data.end());
+    for (size_t i=1; i<other.m_offset.size(); ++i)
+        m_offset.push_back(off+other.m_offset[i]);
+}
+
+
+/** Constructor
+ *
+ * @param col collator (not owned) or NULL for bytewise comparisons
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+StriSortKeyHashSet::StriSortKeyHashSet(UCollator* col)
+    : m_col(col), m_bytesSlots(16, -1), m_classesSlots(16, -1)
+{
+}
+
+
+/** Double the number of slots and reinsert all the entries
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void StriSortKeyHashSet::rehash(const std::vector<Entry>& entries,
+    std::vector<R_len_t>& slots)
+{
+    size_t nslots = 2*slots.size();
+    slots.assign(nslots, -1);
+    size_t mask = nslots-1;
+    for (size_t e=0; e<entries.size(); ++e) {
+        size_t k = (size_t)entries[e].hash&mask;
+        while (slots[k] >= 0) k = (k+1)&mask;
+        slots[k] = (R_len_t)e;
+    }
+}
+
+
+/** Find a bytewise identical string
+ *
+ * @return slot index (the slot is empty if not found)
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+R_len_t StriSortKeyHashSet::findBytes(const String8& s, uint64_t hash) const
+{
+    size_t mask = m_bytesSlots.size()-1;
+    size_t k = (size_t)hash&mask;
+    while (m_bytesSlots[k] >= 0) {
+        const Entry& e = m_bytes[m_bytesSlots[k]];
+        if (e.hash == hash && e.len == s.length() &&
+                0 == memcmp(e.str, s.c_str(), e.len))
+            break;
+        k = (k+1)&mask;
+    }
+    return (R_len_t)k;
+}
+
+
+/** Find an equivalent string, given the hash of its sort key
+ *
+ * @return slot index (the slot is empty if not found)
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+R_len_t StriSortKeyHashSet::findClass(const String8& s, uint64_t hash) const
+{
+    size_t mask = m_classesSlots.size()-1;
+    size_t k = (size_t)hash&mask;
+    while (m_classesSlots[k] >= 0) {
+        const Entry& e = m_classes[m_classesSlots[k]];
+        if (e.hash == hash) {
+            UErrorCode status = U_ZERO_ERROR;
+            int ret = (int)ucol_strcollUTF8(m_col, e.str, e.len,
+                s.c_str(), s.length(), &status);
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+            if (ret == 0) break;
+        }
+        k = (k+1)&mask;
+    }
+    return (R_len_t)k;
+}
+
+
+/** Insert a string
+ *
+ * @param s UTF-8 string, not NA; must outlive the set
+ * @param inserted [out] whether s is the first string of its class;
+ *     may be NULL
+ * @return equivalence class id
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+R_len_t StriSortKeyHashSet::insert(const String8& s, bool* inserted)
+{
+    uint64_t bhash = stri__hash_bytes(s.c_str(), s.length());
+    R_len_t bk = findBytes(s, bhash);
+    if (m_bytesSlots[bk] >= 0) {
+        // an exact duplicate
+        if (inserted) *inserted = false;
+        return m_bytes[m_bytesSlots[bk]].id;
+    }
+
+    R_len_t id;
+    if (!m_col) {
+        // bytewise identity only
+        if (inserted) *inserted = true;
+        id = (R_len_t)m_classes.size();
+        m_classes.push_back(Entry(s.c_str(), s.length(), id, bhash));
+    }
+    else {
+        size_t klen = stri__sortkey_generate(m_col, s, m_buf, m_key, 0);
+        uint64_t khash = stri__hash_bytes(m_key.data(), klen);
+        R_len_t ck = findClass(s, khash);
+        if (m_classesSlots[ck] >= 0) {
+            if (inserted) *inserted = false;
+            id = m_classes[m_classesSlots[ck]].id;
+        }
+        else {
+            if (inserted) *inserted = true;
+            id = (R_len_t)m_classes.size();
+            m_classesSlots[ck] = id;
+            m_classes.push_back(Entry(s.c_str(), s.length(), id, khash));
+            if (2*m_classes.size() > m_classesSlots.size())
+                rehash(m_classes, m_classesSlots);
+        }
+    }
+
+    m_bytesSlots[bk] = (R_len_t)m_bytes.size();
+    m_bytes.push_back(Entry(s.c_str(), s.length(), id, bhash));
+    if (2*m_bytes.size() > m_bytesSlots.size())
+        rehash(m_bytes, m_bytesSlots);
+
+    return id;
+}
+
+
+/** Find the equivalence class of a string
+ *
+ * @param s UTF-8 string, not NA
+ * @return equivalence class id or -1 if not found
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+R_len_t StriSortKeyHashSet::find(const String8& s)
+{
+    uint64_t bhash = stri__hash_bytes(s.c_str(), s.length());
+    R_len_t bk = findBytes(s, bhash);
+    if (m_bytesSlots[bk] >= 0)
+        return m_bytes[m_bytesSlots[bk]].id;
+    else if (!m_col)
+        return -1;
+
+    size_t klen = stri__sortkey_generate(m_col, s, m_buf, m_key, 0);
+    uint64_t khash = stri__hash_bytes(m_key.data(), klen);
+    R_len_t ck = findClass(s, khash);
+    if (m_classesSlots[ck] >= 0)
+        return m_classes[m_classesSlots[ck]].id;
+    else
+        return -1;
+}
+
+
+/** Stable MSD radix sort on sort keys
+ *
+ * Sorts order[from..from+n-1] w.r.t. the keys (all the keys are assumed
+ * to share the same first depth bytes); tmp is an auxiliary array
+ * of the same size as order. Buckets are processed in a LIFO manner
+ * (no recursion: the keys may be long).
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static void stri__sortkeys_radix(int* order, int* tmp, R_len_t n,
+    const StriSortKeys& keys, bool decreasing)
+{
+    struct Bucket {
+        R_len_t from;
+        R_len_t n;
+        size_t depth;
+        Bucket(R_len_t _from, R_len_t _n, size_t _depth)
+            : from(_from), n(_n), depth(_depth) { }
+    };
+
+    std::vector<Bucket> todo;
+    todo.push_back(Bucket(0, n, 0));
+    R_len_t count[257];
+    while (!todo.empty()) {
+        Bucket cur = todo.back();
+        todo.pop_back();
+
+        int* a = order+cur.from;
+        if (cur.n < STRI__SORTKEY_RADIX_MIN) {
+            std::stable_sort(a, a+cur.n,
+                StriSortKeysComparer(&keys, cur.depth, decreasing));
+            continue;
+        }
+
+        // counting sort w.r.t. the depth-th byte;
+        // bucket 0 - keys of length depth (all equal)
+        std::fill(count, count+257, 0);
+        for (R_len_t k=0; k<cur.n; ++k)
+            count[keys.byteAt(a[k], cur.depth)]++;
+
+        if (count[0] == cur.n)
+            continue; // all keys are equal
+        int b0 = keys.byteAt(a[0], cur.depth);
+        if (count[b0] == cur.n) {
+            // a common byte - no need to move anything
+            todo.push_back(Bucket(cur.from, cur.n, cur.depth+1));
+            continue;
+        }
+
+        // bucket start positions; in decreasing order, shorter keys go last
+        R_len_t pos[257];
+        R_len_t p = 0;
+        for (int b=0; b<257; ++b) {
+            int bb = decreasing?(256-b):b;
+            pos[bb] = p;
+            p += count[bb];
+        }
+
+        int* t = tmp+cur.from;
+        for (R_len_t k=0; k<cur.n; ++k)
+            t[pos[keys.byteAt(a[k], cur.depth)]++] = a[k];
+        std::copy(t, t+cur.n, a);
+
+        // now pos[b] is one past the end of the b-th bucket
+        for (int b=1; b<257; ++b) {
+            if (count[b] > 1)
+                todo.push_back(Bucket(cur.from+pos[b]-count[b], count[b], cur.depth+1));
+        }
+    }
+}
+
+
+/** Sort indices w.r.t. the corresponding sort keys (stable)
+ *
+ * @param order indices of the keys to sort (in-place)
+ * @param keys sort keys
+ * @param decreasing sort order
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void stri__sortkeys_order(std::vector<int>& order, const StriSortKeys& keys,
+    bool decreasing)
+{
+    R_len_t n = (R_len_t)order.size();
+    if (n <= 1) return;
+    std::vector<int> tmp(n);
+    stri__sortkeys_radix(order.data(), tmp.data(), n, keys, decreasing);
+}
+
+
+/** Merges consecutive pairs of sorted runs (a stri__parallel_for worker)
+ *
+ * The output index range [from, to) may start or end in the middle
+ * of a pair: the corresponding input positions are determined
+ * by a binary search along the "merge path".
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriSortKeysMergeWorker {
+
+private:
+
+    const int* src;
+    int* dst;
+    const std::vector<R_len_t>& runs;
+    StriSortKeysComparer comp;
+
+    StriSortKeysMergeWorker& operator=(const StriSortKeysMergeWorker&);
+
+    /** the number of elements taken from a[0..na-1] among the first m
+     *  elements of the merge of a and b (ties: a goes first) */
+    R_len_t split(const int* a, R_len_t na, const int* b, R_len_t nb, R_len_t m) const
+    {
+        R_len_t lo = (m > nb)?(m-nb):0;
+        R_len_t hi = (m < na)?m:na;
+        while (lo < hi) {
+            R_len_t mid = lo+(hi-lo)/2;
+            if (!comp(b[m-mid-1], a[mid]))
+                lo = mid+1; // a[mid] goes before b[m-mid-1]
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+public:
+
+    StriSortKeysMergeWorker(const int* _src, int* _dst,
+            const std::vector<R_len_t>& _runs, const StriSortKeys& keys,
+            bool decreasing)
+        : src(_src), dst(_dst), runs(_runs), comp(&keys, 0, decreasing)
+    { }
+
+    StriSortKeysMergeWorker(const StriSortKeysMergeWorker& worker)
+        : src(worker.src), dst(worker.dst), runs(worker.runs), comp(worker.comp)
+    { }
+
+    void operator()(R_len_t from, R_len_t to)
+    {
+        R_len_t nruns = (R_len_t)runs.size()-1;
+        for (R_len_t p=0; p<nruns; p+=2) {
+            R_len_t s = runs[p], m = runs[p+1];
+            R_len_t e = (p+2 <= nruns)?runs[p+2]:m;
+            if (e <= from) continue;
+            if (s >= to) break;
+
+            R_len_t lo = (from > s)?from:s;
+            R_len_t hi = (to < e)?to:e;
+            if (m == e) {
+                // an odd run out
+                std::copy(src+lo, src+hi, dst+lo);
+                continue;
+            }
+
+            const int* a = src+s;
+            const int* b = src+m;
+            R_len_t i0 = split(a, m-s, b, e-m, lo-s);
+            R_len_t i1 = split(a, m-s, b, e-m, hi-s);
+            // std::merge is stable: on ties, elements of a go first
+            std::merge(a+i0, a+i1, b+(lo-s-i0), b+(hi-s-i1), dst+lo, comp);
+        }
+    }
+};
+
+
+/** Merge sorted runs of indices w.r.t. the corresponding sort keys
+ *
+ * Each round merges pairs of consecutive runs, possibly in parallel,
+ * until only one run is left. As the merge is stable, the result is
+ * the same as that of stri__sortkeys_order() on the whole vector
+ * if the runs are consecutive chunks of an increasing sequence of indices
+ * sorted stably.
+ *
+ * @param order indices; sorted in-place
+ * @param runs run boundaries: the i-th run is order[runs[i]..runs[i+1]-1];
+ *     runs[0] == 0, runs.back() == order.size()
+ * @param keys sort keys
+ * @param decreasing sort order
+ * @param nthreads as returned by stri__get_num_threads()
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+void stri__sortkeys_merge(std::vector<int>& order,
+    const std::vector<R_len_t>& runs, const StriSortKeys& keys,
+    bool decreasing, int nthreads)
+{
+    R_len_t n = (R_len_t)order.size();
+    std::vector<R_len_t> cur(runs);
+    std::vector<int> tmp(n);
+    int* src = order.data();
+    int* dst = tmp.data();
+    while (cur.size() > 2) {
+        StriSortKeysMergeWorker worker(src, dst, cur, keys, decreasing);
+        stri__parallel_for(worker, n, nthreads);
+
+        std::vector<R_len_t> next;
+        for (size_t p=0; p+1<cur.size(); p+=2)
+            next.push_back(cur[p]);
+        next.push_back(n);
+        cur.swap(next);
+        std::swap(src, dst);
+    }
+
+    if (src != order.data())
+        order.swap(tmp);
+}
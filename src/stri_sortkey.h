@@ -0,0 +1,287 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+#ifndef __stri_sortkey_h
+#define __stri_sortkey_h
+
+
+#include "stri_stringi.h"
+#include "stri_string8.h"
+#include "stri_collator.h"
+#include <unicode/ucol.h>
+#include <vector>
+#include <cstring>
+
+
+/* Collation via sort keys
+ *
+ * Comparing two strings with ucol_strcollUTF8() needs to process
+ * them every time from scratch. For longer vectors, it is much faster
+ * to generate the ICU sort keys once per string (a sort key is
+ * a sequence of bytes such that comparing two keys via memcmp gives
+ * the same result as comparing the corresponding strings with
+ * ucol_strcoll; equal keys denote strings that are equal
+ * w.r.t. the collator) and then operate on the keys only.
+ */
+
+
+/** vectors shorter than this are sorted via ucol_strcollUTF8()
+ *  (generating the keys does not pay off) */
+#define STRI__SORTKEY_MIN_LENGTH 1024
+
+/** radix sort buckets smaller than this are sorted via comparisons */
+#define STRI__SORTKEY_RADIX_MIN 32
+
+/** in stri_cmp and friends, sort keys are used only if each of them
+ *  is expected to be reused at least this many times */
+#define STRI__SORTKEY_REUSE_MIN 16
+
+
+size_t stri__sortkey_generate(UCollator* col, const String8& s,
+    std::vector<UChar>& buf, std::vector<uint8_t>& out, size_t off);
+
+
+/** A 64-bit hash of a byte sequence (MurmurHash3-like mixing)
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static inline uint64_t stri__hash_bytes(const void* data, size_t n)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    uint64_t h = 0x9e3779b97f4a7c15ULL^(uint64_t)n;
+    uint64_t v;
+    while (n >= 8) {
+        memcpy(&v, p, 8);
+        v *= 0x87c37b91114253d5ULL;
+        v = (v<<31)|(v>>33);
+        v *= 0x4cf5ad432745937fULL;
+        h ^= v;
+        h = ((h<<27)|(h>>37))*5+0x52dce729ULL;
+        p += 8;
+        n -= 8;
+    }
+    v = 0;
+    for (size_t j=0; j<n; ++j)
+        v |= ((uint64_t)p[j])<<(8*j);
+    v *= 0x87c37b91114253d5ULL;
+    v = (v<<31)|(v>>33);
+    v *= 0x4cf5ad432745937fULL;
+    h ^= v;
+
+    // finaliser
+    h ^= h>>33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h>>33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h>>33;
+    return h;
+}
+
+
+/**
+ * A contiguous arena of ICU sort keys of consecutive strings
+ *
+ * The keys are stored without the trailing NUL byte (ICU sort keys
+ * contain no other zero bytes), so that a proper prefix of a key
+ * always precedes it. Missing values are represented by empty keys;
+ * they must be dealt with separately by the caller.
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriSortKeys {
+
+private:
+
+    std::vector<uint8_t> m_data;
+    std::vector<size_t> m_offset; // i-th key is at [m_offset[i], m_offset[i+1])
+    std::vector<UChar> m_buf;     // UTF-16 conversion buffer
+
+    StriSortKeys(const StriSortKeys&); // no copy
+    StriSortKeys& operator=(const StriSortKeys&);
+
+public:
+
+    StriSortKeys() {
+        m_offset.push_back(0);
+    }
+
+    /** preallocate memory for n keys of total size nbytes */
+    void reserve(R_len_t n, size_t nbytes) {
+        m_offset.reserve(n+1);
+        m_data.reserve(nbytes);
+    }
+
+    /** the number of keys stored */
+    inline R_len_t size() const {
+        return (R_len_t)m_offset.size()-1;
+    }
+
+    /** the total size of all the keys in bytes */
+    inline size_t bytes() const {
+        return m_data.size();
+    }
+
+    inline const uint8_t* get(R_len_t i) const {
+        return m_data.data()+m_offset[i];
+    }
+
+    inline size_t length(R_len_t i) const {
+        return m_offset[i+1]-m_offset[i];
+    }
+
+    /** the d-th byte of the i-th key plus 1 or 0 if the key is shorter */
+    inline int byteAt(R_len_t i, size_t d) const {
+        return (d < m_offset[i+1]-m_offset[i])?((int)m_data[m_offset[i]+d]+1):0;
+    }
+
+    /** compare two keys, starting at the d-th byte
+     *  (the preceding ones are assumed to be equal)
+     *
+     * @return <0, 0, or >0, like memcmp
+     */
+    inline int compare(R_len_t i, R_len_t j, size_t d=0) const {
+        size_t ni = length(i), nj = length(j);
+        size_t nmin = (ni < nj)?ni:nj;
+        int ret = (nmin > d)?memcmp(get(i)+d, get(j)+d, nmin-d):0;
+        if (ret != 0) return ret;
+        return (ni < nj)?-1:((ni > nj)?1:0);
+    }
+
+    inline bool equal(R_len_t i, R_len_t j) const {
+        size_t ni = length(i);
+        return ni == length(j) && 0 == memcmp(get(i), get(j), ni);
+    }
+
+    void push_back(UCollator* col, const String8& s);
+    void push_back(const StriCollatorASCII* ascii, const String8& s);
+    void push_back_empty();
+    void append(const StriSortKeys& other);
+};
+
+
+/** help struct for stri__sortkeys_order */
+struct StriSortKeysComparer {
+    const StriSortKeys* keys;
+    size_t depth;
+    bool decreasing;
+
+    StriSortKeysComparer(const StriSortKeys* _keys, size_t _depth, bool _decreasing)
+    {
+        this->keys = _keys;
+        this->depth = _depth;
+        this->decreasing = _decreasing;
+    }
+
+    bool operator() (int a, int b) const
+    {
+        int ret = keys->compare(a, b, depth);
+        return (decreasing)?(ret > 0):(ret < 0);
+    }
+};
+
+
+/**
+ * A hash set of strings w.r.t. collation-based equality
+ *
+ * Each inserted string is assigned the (0-based) id of its equivalence
+ * class, i.e., the number of distinct strings inserted before the first
+ * string of that class. Strings are identified via the hashes of their
+ * sort keys (canonically equivalent strings have identical sort keys);
+ * equal hashes are confirmed by calling ucol_strcollUTF8, hence
+ * the keys themselves need not be stored. Moreover, strings that are
+ * bytewise identical to the ones already seen are detected via a separate
+ * table, without generating their sort keys at all.
+ * If no collator is given, only the latter table is used,
+ * i.e., the strings are compared bytewise.
+ *
+ * Both tables use open addressing with linear probing.
+ * The set stores pointers to the inserted strings: they must
+ * remain valid throughout the set's lifetime. The collator is not owned.
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriSortKeyHashSet {
+
+private:
+
+    struct Entry {
+        const char* str;
+        R_len_t len;
+        R_len_t id;
+        uint64_t hash;
+        Entry(const char* _str, R_len_t _len, R_len_t _id, uint64_t _hash)
+            : str(_str), len(_len), id(_id), hash(_hash) { }
+    };
+
+    UCollator* m_col;
+
+    std::vector<Entry> m_bytes;       // distinct byte sequences
+    std::vector<R_len_t> m_bytesSlots; // indexes in m_bytes or -1
+
+    std::vector<Entry> m_classes;       // class representatives
+    std::vector<R_len_t> m_classesSlots; // indexes in m_classes or -1
+
+    std::vector<UChar> m_buf;  // UTF-16 conversion buffer
+    std::vector<uint8_t> m_key; // sort key buffer
+
+    StriSortKeyHashSet(const StriSortKeyHashSet&); // no copy
+    StriSortKeyHashSet& operator=(const StriSortKeyHashSet&);
+
+    static void rehash(const std::vector<Entry>& entries, std::vector<R_len_t>& slots);
+
+    R_len_t findBytes(const String8& s, uint64_t hash) const;
+    R_len_t findClass(const String8& s, uint64_t hash) const;
+
+public:
+
+    StriSortKeyHashSet(UCollator* col);
+
+    /** the number of equivalence classes */
+    inline R_len_t size() const {
+        return (R_len_t)m_classes.size();
+    }
+
+    R_len_t insert(const String8& s, bool* inserted=NULL);
+    R_len_t find(const String8& s);
+};
+
+
+void stri__sortkeys_order(std::vector<int>& order, const StriSortKeys& keys,
+    bool decreasing);
+
+void stri__sortkeys_merge(std::vector<int>& order,
+    const std::vector<R_len_t>& runs, const StriSortKeys& keys,
+    bool decreasing, int nthreads);
+
+#endif
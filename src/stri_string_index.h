@@ -0,0 +1,113 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+#ifndef __stri_string_index_h
+#define __stri_string_index_h
+
+#include "stri_stringi.h"
+#include "stri_container_utf8.h"
+#include "stri_sortkey.h"
+#include <unicode/ucol.h>
+#include <vector>
+
+
+/**
+ * An index of a character vector for value matching
+ *
+ * The non-missing strings are copied (in UTF-8) to a flat arena,
+ * on top of which a StriSortKeyHashSet is built (which keeps the hashes
+ * of the strings and of their sort keys). Hence, the index does not
+ * refer to any R objects and can be kept alive between calls
+ * (see stri_in_index()); each lookup then costs only a single
+ * hash table probe.
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriStringIndex {
+
+private:
+
+    UCollator* m_col;             // owned; NULL for bytewise comparisons
+    std::vector<char> m_data;     // NUL-terminated strings, one after another
+    std::vector<size_t> m_offset; // k-th string starts at m_offset[k]
+    std::vector<bool> m_ascii;    // whether the j-th string is in ASCII
+    std::vector<int> m_first;     // class id -> 1-based position in table
+    StriSortKeyHashSet m_set;
+    R_len_t m_length;             // table length
+    int m_firstNA;                // 1-based position of the first NA or 0
+
+    StriStringIndex(const StriStringIndex&); // no copy
+    StriStringIndex& operator=(const StriStringIndex&);
+
+public:
+
+    StriStringIndex(StriContainerUTF8& table_cont, R_len_t table_length,
+        UCollator* col);
+
+    ~StriStringIndex() {
+        if (m_col) {
+            ucol_close(m_col);
+            m_col = NULL;
+        }
+    }
+
+    /** whether strings are compared with collation */
+    inline bool isCollationBased() const {
+        return m_col != NULL;
+    }
+
+    /** the length of the indexed vector */
+    inline R_len_t length() const {
+        return m_length;
+    }
+
+    /** the number of distinct non-missing strings */
+    inline R_len_t distinct() const {
+        return m_set.size();
+    }
+
+    /** the 1-based position of the first NA in table or 0 */
+    inline int findNA() const {
+        return m_firstNA;
+    }
+
+    /** the 1-based position of the first match in table or 0 */
+    inline int find(const String8& s) {
+        R_len_t id = m_set.find(s);
+        return (id < 0)?0:m_first[id];
+    }
+};
+
+
+#endif
@@ -63,6 +63,7 @@ const R_CallMethodDef cCallMethods[] = {
     STRI__MK_CALL("C_stri_cmp_ge",                       stri_cmp_ge,                     3),
     STRI__MK_CALL("C_stri_cmp_equiv",                    stri_cmp_equiv,                  3),
     STRI__MK_CALL("C_stri_cmp_nequiv",                   stri_cmp_nequiv,                 3),
+    STRI__MK_CALL("C_stri_collator_cache",               stri_collator_cache,             2),
     STRI__MK_CALL("C_stri_count_boundaries",             stri_count_boundaries,           2),
     STRI__MK_CALL("C_stri_count_charclass",              stri_count_charclass,            2),
     STRI__MK_CALL("C_stri_count_fixed",                  stri_count_fixed,                3),
@@ -79,7 +80,9 @@ const R_CallMethodDef cCallMethods[] = {
     STRI__MK_CALL("C_stri_detect_charclass",             stri_detect_charclass,           4),
     STRI__MK_CALL("C_stri_detect_coll",                  stri_detect_coll,                5),
     STRI__MK_CALL("C_stri_detect_fixed",                 stri_detect_fixed,               5),
+    STRI__MK_CALL("C_stri_detect_fixed_any",             stri_detect_fixed_any,           4),
     STRI__MK_CALL("C_stri_detect_regex",                 stri_detect_regex,               5),
+    STRI__MK_CALL("C_stri_detect_regex_any",             stri_detect_regex_any,           4),
     STRI__MK_CALL("C_stri_dup",                          stri_dup,                        2),
     STRI__MK_CALL("C_stri_duplicated",                   stri_duplicated,                 3),
     STRI__MK_CALL("C_stri_duplicated_any",               stri_duplicated_any,             3),
@@ -120,6 +123,11 @@ const R_CallMethodDef cCallMethods[] = {
     STRI__MK_CALL("C_stri_extract_last_regex",           stri_extract_last_regex,         3),
     STRI__MK_CALL("C_stri_extract_all_regex",            stri_extract_all_regex,          5),
     STRI__MK_CALL("C_stri_flatten",                      stri_flatten,                    4),
+    STRI__MK_CALL("C_stri_group",                        stri_group,                      3),
+    STRI__MK_CALL("C_stri_in_coll",                      stri_in_coll,                    4),
+    STRI__MK_CALL("C_stri_in_fixed",                     stri_in_fixed,                   3),
+    STRI__MK_CALL("C_stri_in_index",                     stri_in_index,                   3),
+    STRI__MK_CALL("C_stri_in_index_info",                stri_in_index_info,              1),
     STRI__MK_CALL("C_stri_info",                         stri_info,                       0),
     STRI__MK_CALL("C_stri_isempty",                      stri_isempty,                    1),
     STRI__MK_CALL("C_stri_join",                         stri_join,                       4),
@@ -150,9 +158,11 @@ const R_CallMethodDef cCallMethods[] = {
     STRI__MK_CALL("C_stri_match_all_regex",              stri_match_all_regex,            5),
     STRI__MK_CALL("C_stri_numbytes",                     stri_numbytes,                   1),
     STRI__MK_CALL("C_stri_order",                        stri_order,                      4),
+    STRI__MK_CALL("C_stri_order_topk",                   stri_order_topk,                 5),
     STRI__MK_CALL("C_stri_rank",                         stri_rank,                       2),
     STRI__MK_CALL("C_stri_sort",                         stri_sort,                       4),
     STRI__MK_CALL("C_stri_sort_key",                     stri_sort_key,                   2),
+    STRI__MK_CALL("C_stri_sort_topk",                    stri_sort_topk,                  5),
     STRI__MK_CALL("C_stri_pad",                          stri_pad,                        5),
     STRI__MK_CALL("C_stri_prepare_arg_string",           stri_prepare_arg_string,         2),
     STRI__MK_CALL("C_stri_prepare_arg_double",           stri_prepare_arg_double,         2),
@@ -165,6 +175,7 @@ const R_CallMethodDef cCallMethods[] = {
     STRI__MK_CALL("C_stri_prepare_arg_logical_1",        stri_prepare_arg_logical_1,      2),
     STRI__MK_CALL("C_stri_rand_shuffle",                 stri_rand_shuffle,               1),
     STRI__MK_CALL("C_stri_rand_strings",                 stri_rand_strings,               3),
+    STRI__MK_CALL("C_stri_regex_cache",                  stri_regex_cache,                2),
     STRI__MK_CALL("C_stri_replace_na",                   stri_replace_na,                 2),
     STRI__MK_CALL("C_stri_replace_rstr",                 stri_replace_rstr,               1),
     STRI__MK_CALL("C_stri_replace_all_fixed",            stri_replace_all_fixed,          5),
@@ -205,6 +216,7 @@ const R_CallMethodDef cCallMethods[] = {
     STRI__MK_CALL("C_stri_subset_coll_replacement",      stri_subset_coll_replacement,    5),
     STRI__MK_CALL("C_stri_subset_fixed_replacement",     stri_subset_fixed_replacement,   5),
     STRI__MK_CALL("C_stri_subset_regex_replacement",     stri_subset_regex_replacement,   5),
+    STRI__MK_CALL("C_stri_test_bytesearch",              stri_test_bytesearch,            4),
     STRI__MK_CALL("C_stri_test_Rmark",                   stri_test_Rmark,                 1),
     STRI__MK_CALL("C_stri_test_returnasis",              stri_test_returnasis,            1),
     STRI__MK_CALL("C_stri_test_UnicodeContainer16",      stri_test_UnicodeContainer16,    1),
@@ -338,6 +350,8 @@ extern "C" void R_init_stringi(DllInfo* dll)
 #ifndef NDEBUG
 
 #include <unicode/uclean.h>
+#include "stri_container_regex.h"
+#include "stri_collator.h"
 
 /**
  * Library cleanup
@@ -346,6 +360,9 @@ extern "C" void  R_unload_stringi(DllInfo*)
 {
     // see http://bugs.icu-project.org/trac/ticket/10897
     // and https://github.com/Rexamine/stringi/issues/78
+    StriRegexPatternCache::clear();  // before u_cleanup()
+    StriCollatorCache::clear();
+    StriCollatorASCII::clear();
     u_cleanup();
 }
 
@@ -57,6 +57,7 @@ int     stri__match_arg(const char* option, const char** set);
 // collator.cpp:
 struct UCollator;
 UCollator* stri__ucol_open(SEXP opts_collator);
+UCollator* stri__ucol_clone(const UCollator* col);
 
 // length.cpp
 R_len_t stri__numbytes_max(SEXP str);
@@ -106,6 +107,34 @@ SEXP stri__prepare_arg_raw(SEXP x,          const char* argname, bool factors_as
 
 SEXP stri__prepare_arg_POSIXct(SEXP x,      const char* argname);
 
+bool stri__is_plain_factor(SEXP x);
+SEXP stri__factor_as_character(SEXP x);
+SEXP stri__prepare_arg_factor(SEXP x, SEXP* levels);
+SEXP stri__prepare_arg_string_dedup(SEXP x, SEXP* levels);
+SEXP stri__prepare_arg_dedup(SEXP x, SEXP* levels);
+SEXP stri__dedup_gather(SEXP x, SEXP index);
+
+/* Process each distinct value of `str` once; to be used before `str`
+ * is prepared. If `str` is a plain factor with fewer levels than
+ * elements or a long character vector with many duplicated CHARSXPs,
+ * and `cond` holds (i.e., the result for each element of `str` depends
+ * on that element only), evaluate `call` with `str` replaced by
+ * its distinct values and expand the result by means of the codes. */
+#define STRI__DEDUP_DISPATCH(str, cond, call)                               \
+    if ((cond) && (Rf_isString(str) || Rf_isFactor(str))) {                 \
+        SEXP stri__dedup_levels;                                            \
+        SEXP stri__dedup_index = stri__prepare_arg_dedup(str, &stri__dedup_levels); \
+        if (!Rf_isNull(stri__dedup_index)) {                                \
+            PROTECT(stri__dedup_index);                                     \
+            PROTECT(str = stri__dedup_levels);                              \
+            SEXP stri__dedup_ret;                                           \
+            PROTECT(stri__dedup_ret = (call));                              \
+            stri__dedup_ret = stri__dedup_gather(stri__dedup_ret, stri__dedup_index); \
+            UNPROTECT(3);                                                   \
+            return stri__dedup_ret;                                         \
+        }                                                                   \
+    }
+
 
 
 // search
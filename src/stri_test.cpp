@@ -33,6 +33,7 @@
 #include "stri_stringi.h"
 #include "stri_container_utf8.h"
 #include "stri_container_utf16.h"
+#include "stri_bytesearch_matcher.h"
 
 
 /** dummy fun to measure the performance of .Call
@@ -139,3 +140,73 @@ SEXP stri_test_UnicodeContainer8(SEXP str)
     return R_NilValue;
     STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
 }
+
+
+/** Find a pattern with a given byte search matcher [internal]
+ *
+ * Bypasses StriContainerByteSearch::getMatcher(), so that the matchers
+ * can be compared against each other in tests whatever the CPU's
+ * SIMD support.
+ *
+ * @param str single string
+ * @param pattern single string of at least 2 bytes
+ * @param matcher single integer; 0 - StriByteSearchMatcherKMP,
+ *    1 - StriByteSearchMatcherHorspool, 2 - StriByteSearchMatcherSIMD
+ * @param overlap single logical
+ * @return list with two integer vectors: \code{all} - the 1-based byte
+ *    indices of the consecutive matches (findFirst(), findNext()) and
+ *    \code{last} - that of the last one (findLast()) or NA
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+SEXP stri_test_bytesearch(SEXP str, SEXP pattern, SEXP matcher, SEXP overlap)
+{
+    PROTECT(str = stri__prepare_arg_string_1(str, "str"));
+    PROTECT(pattern = stri__prepare_arg_string_1(pattern, "pattern"));
+    int matcher_val = stri__prepare_arg_integer_1_notNA(matcher, "matcher");
+    bool overlap_val = stri__prepare_arg_logical_1_notNA(overlap, "overlap");
+
+    StriByteSearchMatcher* m = NULL;
+    STRI__ERROR_HANDLER_BEGIN(2)
+    StriContainerUTF8 str_cont(str, 1);
+    StriContainerUTF8 pattern_cont(pattern, 1);
+    if (str_cont.isNA(0) || pattern_cont.isNA(0) || pattern_cont.get(0).length() < 2)
+        throw StriException(MSG__INCORRECT_INTERNAL_ARG);
+
+    const char* p_s = pattern_cont.get(0).c_str();
+    R_len_t p_n = pattern_cont.get(0).length();
+    switch (matcher_val) {
+        case 0: m = new StriByteSearchMatcherKMP(p_s, p_n, overlap_val); break;
+        case 1: m = new StriByteSearchMatcherHorspool(p_s, p_n, overlap_val); break;
+        case 2: m = new StriByteSearchMatcherSIMD(p_s, p_n, overlap_val); break;
+        default: throw StriException(MSG__INCORRECT_INTERNAL_ARG);
+    }
+
+    std::vector<int> all;
+    m->reset(str_cont.get(0).c_str(), str_cont.get(0).length());
+    for (R_len_t k = m->findFirst(); k != USEARCH_DONE; k = m->findNext())
+        all.push_back(k+1);
+
+    m->reset(str_cont.get(0).c_str(), str_cont.get(0).length());
+    R_len_t last = m->findLast();
+
+    delete m;
+    m = NULL;
+
+    SEXP ret, ret_all;
+    STRI__PROTECT(ret = Rf_allocVector(VECSXP, 2));
+    STRI__PROTECT(ret_all = Rf_allocVector(INTSXP, (R_len_t)all.size()));
+    for (size_t j=0; j<all.size(); ++j)
+        INTEGER(ret_all)[j] = all[j];
+    SET_VECTOR_ELT(ret, 0, ret_all);
+    SET_VECTOR_ELT(ret, 1, Rf_ScalarInteger((last == USEARCH_DONE)?NA_INTEGER:(last+1)));
+    stri__set_names(ret, 2, "all", "last");
+    STRI__UNPROTECT_ALL
+    return ret;
+    STRI__ERROR_HANDLER_END(
+        if (m) {
+            delete m;
+            m = NULL;
+        }
+    )
+}
@@ -0,0 +1,74 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "stri_stringi.h"
+#include "stri_thread.h"
+#include "stri_bytesearch_matcher.h"
+
+
+/** Get the maximal number of threads to be used by stri__parallel_for()
+ *
+ * Reads `getOption("stringi.num_threads")`; the default (NULL) is 1.
+ *
+ * WARNING: this function is allowed to call the error() function.
+ * Use before STRI__ERROR_HANDLER_BEGIN (with other prepareargs).
+ *
+ * @return the number of threads, >= 1
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+int stri__get_num_threads()
+{
+    SEXP opt = Rf_GetOption1(Rf_install("stringi.num_threads"));
+    if (Rf_isNull(opt))
+        return 1;
+
+    int nthreads = stri__prepare_arg_integer_1_notNA(opt, "stringi.num_threads");
+    if (nthreads < 1)
+        Rf_error(MSG__INCORRECT_NAMED_ARG "; " MSG__EXPECTED_POSITIVE,
+            "stringi.num_threads"); // allowed here
+
+#ifdef _OPENMP
+    if (nthreads > omp_get_thread_limit())
+        nthreads = omp_get_thread_limit();
+    if (nthreads <= 1)
+        return 1;
+
+    // lazily initialised process-wide state must be set up before
+    // the threads start
+    stri__bytesearch_simd_level();
+
+    return nthreads;
+#else
+    return 1;
+#endif
+}
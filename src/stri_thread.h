@@ -0,0 +1,243 @@
+/* This file is part of the 'stringi' project.
+ * Copyright (c) 2013-2025, Marek Gagolewski <https://www.gagolewski.com/>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef __stri_thread_h
+#define __stri_thread_h
+
+
+#include "stri_stringi.h"
+#include <new>
+#include <cstring>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+/* Opt-in multithreading
+ *
+ * Vectorised functions that support it call stri__get_num_threads()
+ * before STRI__ERROR_HANDLER_BEGIN (it reads
+ * `getOption("stringi.num_threads")`) and then pass a "worker"
+ * to stri__parallel_for().
+ *
+ * A worker is an object with a copy constructor that clones all the state
+ * that may not be shared between threads (e.g., containers with cached
+ * matchers) and an operator()(R_len_t from, R_len_t to) that processes
+ * the index range [from, to). Workers must not call any R API functions;
+ * they may only write to preallocated result buffers (e.g., LOGICAL(ret)).
+ *
+ * A StriException (or std::bad_alloc) thrown by any worker is re-thrown
+ * by stri__parallel_for() on the main thread (within the
+ * STRI__ERROR_HANDLER_BEGIN/END block), after all the threads have finished.
+ */
+
+
+/** the minimal number of vector elements per thread */
+#define STRI__THREAD_MIN_ITEMS 256
+
+/** the number of chunks per thread (load balancing) */
+#define STRI__THREAD_CHUNKS 8
+
+
+int stri__get_num_threads();
+
+
+/** A mutex (a no-op if OpenMP is not available)
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriLock {
+
+private:
+
+#ifdef _OPENMP
+    omp_lock_t lock;
+#endif
+
+    StriLock(const StriLock&); // no copy
+    StriLock& operator=(const StriLock&);
+
+public:
+
+    StriLock() {
+#ifdef _OPENMP
+        omp_init_lock(&lock);
+#endif
+    }
+
+    ~StriLock() {
+#ifdef _OPENMP
+        omp_destroy_lock(&lock);
+#endif
+    }
+
+    inline void acquire() {
+#ifdef _OPENMP
+        omp_set_lock(&lock);
+#endif
+    }
+
+    inline void release() {
+#ifdef _OPENMP
+        omp_unset_lock(&lock);
+#endif
+    }
+};
+
+
+/** Holds a StriLock for as long as it is in scope (exception-safe)
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriLockGuard {
+
+private:
+
+    StriLock& lock;
+
+    StriLockGuard(const StriLockGuard&); // no copy
+    StriLockGuard& operator=(const StriLockGuard&);
+
+public:
+
+    StriLockGuard(StriLock& _lock) : lock(_lock) { lock.acquire(); }
+    ~StriLockGuard() { lock.release(); }
+};
+
+
+/** Remembers the first error reported by any of the threads
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriThreadError {
+
+private:
+
+    StriLock lock;
+    bool failed;
+    char msg[StriException_BUFSIZE];
+
+public:
+
+    StriThreadError() : failed(false) { msg[0] = '\0'; }
+
+    void set(const char* _msg) {
+        StriLockGuard guard(lock);
+        if (failed) return; // keep the first one
+        strncpy(msg, _msg, StriException_BUFSIZE-1);
+        msg[StriException_BUFSIZE-1] = '\0';
+        failed = true;
+    }
+
+    bool isSet() {
+        StriLockGuard guard(lock);
+        return failed;
+    }
+
+    void rethrow() {
+        if (failed) throw StriException("%s", msg);
+    }
+};
+
+
+/** Call worker(from, to) on consecutive chunks of [0, n),
+ *  possibly in parallel
+ *
+ * If more than one thread is used, each one has its own copy of the worker
+ * (the original one is not called at all then).
+ * Short vectors are always processed by a single thread.
+ * Chunks are contiguous; within each chunk, workers should visit the
+ * elements in the same order as StriContainerBase::vectorize_next()
+ * (so that they can reuse their matchers and produce the same results
+ * as the serial version if this matters, e.g., with `max_count`).
+ *
+ * @param worker see above
+ * @param n vector length
+ * @param nthreads as returned by stri__get_num_threads()
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+template <class Worker>
+void stri__parallel_for(Worker& worker, R_len_t n, int nthreads)
+{
+#ifdef _OPENMP
+    if (nthreads > n/STRI__THREAD_MIN_ITEMS)
+        nthreads = n/STRI__THREAD_MIN_ITEMS;
+
+    if (nthreads > 1) {
+        R_len_t nchunks = nthreads*STRI__THREAD_CHUNKS;
+        if (nchunks > n) nchunks = n;
+        StriThreadError error;
+
+        #pragma omp parallel num_threads(nthreads)
+        {
+            Worker* thread_worker = NULL;
+            try {
+                thread_worker = new Worker(worker);
+            }
+            catch (StriException& e) {
+                error.set(e.getMessage());
+            }
+            catch (std::bad_alloc&) {
+                error.set(MSG__MEM_ALLOC_ERROR);
+            }
+
+            #pragma omp for schedule(dynamic)
+            for (R_len_t c=0; c<nchunks; ++c) {
+                if (!thread_worker || error.isSet()) continue;
+                R_len_t from = (R_len_t)(((double)c*n)/nchunks);
+                R_len_t to   = (R_len_t)(((double)(c+1)*n)/nchunks);
+                try {
+                    (*thread_worker)(from, to);
+                }
+                catch (StriException& e) {
+                    error.set(e.getMessage());
+                }
+                catch (std::bad_alloc&) {
+                    error.set(MSG__MEM_ALLOC_ERROR);
+                }
+            }
+
+            if (thread_worker) delete thread_worker;
+        }
+
+        error.rethrow();
+        return;
+    }
+#endif
+
+    worker(0, n);
+}
+
+
+#endif
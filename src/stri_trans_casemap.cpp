@@ -42,6 +42,46 @@
 #define STRI_CASEMAP_CASEFOLD  3
 
 
+/** Is the result of a case mapping the same as the original string?
+ *
+ * If so, the original CHARSXP can be reused, which avoids
+ * a lookup in R's global string cache
+ *
+ * @param buf case mapped string, UTF-8
+ * @param buf_n its length in bytes
+ * @param curs original CHARSXP, not NA
+ * @return bool
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static inline bool stri__casemap_unchanged(const char* buf, R_len_t buf_n, SEXP curs)
+{
+    return buf_n == LENGTH(curs) &&
+        (IS_ASCII(curs) || IS_UTF8(curs)) &&
+        memcmp(buf, CHAR(curs), buf_n) == 0;
+}
+
+
+/** Does an ASCII string contain no letters from a given range?
+ *
+ * @param s string
+ * @param n number of bytes
+ * @param from first letter, e.g., 'A'
+ * @param to last letter, e.g., 'Z'
+ * @return bool
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+static inline bool stri__ascii_has_no_letters(const char* s, R_len_t n, char from, char to)
+{
+    for (R_len_t j=0; j<n; ++j) {
+        if (s[j] >= from && s[j] <= to)
+            return false;
+    }
+    return true;
+}
+
+
 /**
  *  Convert case (TitleCase)
  *
@@ -53,9 +93,15 @@
  * @version 0.4-1 (Marek Gagolewski, 2014-12-03)
  *    separated from stri_trans_casemap;
  *    use StriUBreakIterator
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch;
+ *    reuse the CHARSXPs of the strings left intact
  */
 SEXP stri_trans_totitle(SEXP str, SEXP opts_brkiter) {
     StriBrkIterOptions opts_brkiter2(opts_brkiter, "word");
+    STRI__DEDUP_DISPATCH(str, true,
+        stri_trans_totitle(str, opts_brkiter))
     PROTECT(str = stri__prepare_arg_string(str, "str")); // prepare string argument
 
 // version 0.2-1 - Does not work with ICU 4.8 (but we require ICU >= 50)
@@ -119,7 +165,11 @@ SEXP stri_trans_totitle(SEXP str, SEXP opts_brkiter) {
             // we do have the buffer size required to complete this op
         }
 
-        SET_STRING_ELT(ret, i, Rf_mkCharLenCE(buf.data(), buf_need, CE_UTF8));
+        SEXP curs = STRING_ELT(str, i);
+        if (stri__casemap_unchanged(buf.data(), buf_need, curs))
+            SET_STRING_ELT(ret, i, curs);
+        else
+            SET_STRING_ELT(ret, i, Rf_mkCharLenCE(buf.data(), buf_need, CE_UTF8));
     }
 
     if (ucasemap) {
@@ -180,12 +230,18 @@ SEXP stri_trans_totitle(SEXP str, SEXP opts_brkiter) {
  *
  * @version 1.6.1 (Marek Gagolewski, 2021-04-30)
  *    add casefold
-*/
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch;
+ *    ASCII quick check, reuse the CHARSXPs of the strings left intact
+ */
 SEXP stri_trans_casemap(SEXP str, int _type, SEXP locale)
 {
     if (_type < 1 || _type > 3)
         Rf_error(MSG__INCORRECT_INTERNAL_ARG);
     const char* qloc = stri__prepare_arg_locale(locale, "locale"); /* this is R_alloc'ed */
+    STRI__DEDUP_DISPATCH(str, true,
+        stri_trans_casemap(str, _type, locale))
     PROTECT(str = stri__prepare_arg_string(str, "str")); // prepare string argument
 
     // version 0.2-1 - Does not work with ICU 4.8 (but we require ICU >= 50)
@@ -228,6 +284,15 @@ SEXP stri_trans_casemap(SEXP str, int _type, SEXP locale)
         R_len_t str_cur_n     = str_cont.get(i).length();
         const char* str_cur_s = str_cont.get(i).c_str();
 
+        // quick check: ASCII strings with no letters to change stay as-is
+        // (in all locales); the String8 is a shallow copy of the CHARSXP
+        if (str_cont.get(i).isASCII() && ((_type == STRI_CASEMAP_TOUPPER)
+                ? stri__ascii_has_no_letters(str_cur_s, str_cur_n, 'a', 'z')
+                : stri__ascii_has_no_letters(str_cur_s, str_cur_n, 'A', 'Z'))) {
+            SET_STRING_ELT(ret, i, STRING_ELT(str, i));
+            continue;
+        }
+
         int buf_need;
         bool retry = false;
         while (true) {
@@ -263,7 +328,11 @@ SEXP stri_trans_casemap(SEXP str, int _type, SEXP locale)
             }
         }
 
-        SET_STRING_ELT(ret, i, Rf_mkCharLenCE(buf.data(), buf_need, CE_UTF8));
+        SEXP curs = STRING_ELT(str, i);
+        if (stri__casemap_unchanged(buf.data(), buf_need, curs))
+            SET_STRING_ELT(ret, i, curs);
+        else
+            SET_STRING_ELT(ret, i, Rf_mkCharLenCE(buf.data(), buf_need, CE_UTF8));
     }
 
     if (ucasemap) {
@@ -30,7 +30,7 @@
  */
 
 #include "stri_stringi.h"
-#include "stri_container_utf16.h"
+#include "stri_container_utf16_chunked.h"
 #include <unicode/normalizer2.h>
 
 
@@ -94,6 +94,32 @@ const Normalizer2* stri__normalizer_get(int _type)
 }
 
 
+/**
+ * A quick check for stri_trans_nf: is a UTF-8 string already normalized?
+ *
+ * @version 1.8.8 (2026-10-16)
+ */
+class StriNormalizerQuickCheck : public StriUTF8QuickCheck {
+private:
+    const Normalizer2* normalizer;
+    bool ascii_unchanged;  ///< leaves all ASCII strings as-is?
+
+public:
+    StriNormalizerQuickCheck(const Normalizer2* _normalizer, int _type)
+        : normalizer(_normalizer), ascii_unchanged(_type != STRI_UNINORM_NFKC_CF)
+    { }
+
+    virtual bool isUnchanged(const char* s, R_len_t n, bool is_ascii) const {
+        if (is_ascii && ascii_unchanged)
+            return true;
+
+        UErrorCode status = U_ZERO_ERROR;
+        bool ret = normalizer->isNormalizedUTF8(StringPiece(s, n), status);
+        return U_SUCCESS(status) && ret;  // otherwise, let normalize() decide
+    }
+};
+
+
 /**
  * Perform Unicode Normalization
  *
@@ -117,6 +143,11 @@ const Normalizer2* stri__normalizer_get(int _type)
  *
  * @version 0.6-1 (Marek Gagolewski, 2015-07-11)
  *    This is now an internal function
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch;
+ *    use StriContainerUTF16_chunked (peak memory use);
+ *    reuse the CHARSXPs of the strings that are already normalized
  */
 SEXP stri_trans_nf(SEXP str, int type)
 {
@@ -132,22 +163,43 @@ SEXP stri_trans_nf(SEXP str, int type)
     const Normalizer2* normalizer =
         stri__normalizer_get(type); // auto `type` check here, call before ERROR_HANDLER
 
+    STRI__DEDUP_DISPATCH(str, true,
+        stri_trans_nf(str, type))
     PROTECT(str = stri__prepare_arg_string(str, "str"));    // prepare string argument
     R_len_t str_length = LENGTH(str);
 
     STRI__ERROR_HANDLER_BEGIN(1)
-    StriContainerUTF16 str_cont(str, str_length, false); // writable, no recycle
+    StriContainerUTF16_chunked str_cont(str); // writable, a chunk at a time
+    StriNormalizerQuickCheck quick_check(normalizer, type);
 
-    for (R_len_t i=0; i<str_length; ++i) {
-        if (str_cont.isNA(i)) continue;
-        UErrorCode status = U_ZERO_ERROR;
-        str_cont.set(i, normalizer->normalize(str_cont.get(i), status));
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+    SEXP ret;
+    STRI__PROTECT(ret = Rf_allocVector(STRSXP, str_length));
+
+    while (str_cont.nextChunk(&quick_check)) {
+        for (R_len_t i=0; i<str_cont.get_n(); ++i) {
+            if (str_cont.isNA(i) || str_cont.isUnchanged(i)) continue;
+
+            // the normalized prefix need not be processed again
+            UErrorCode status = U_ZERO_ERROR;
+            const UnicodeString& cur = str_cont.get(i);
+            int32_t span = normalizer->spanQuickCheckYes(cur, status);
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+            if (span == cur.length()) {
+                str_cont.setUnchanged(i);
+                continue;
+            }
+
+            UnicodeString out(cur, 0, span);
+            normalizer->normalizeSecondAndAppend(out, cur.tempSubString(span), status);
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+            str_cont.set(i, out);
+        }
+        str_cont.toRChunk(ret);
     }
 
     // normalizer shall not be deleted at all
     STRI__UNPROTECT_ALL
-    return str_cont.toR();
+    return ret;
     STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
 }
 
@@ -173,37 +225,49 @@ SEXP stri_trans_nf(SEXP str, int type)
  *
  * @version 0.6-1 (Marek Gagolewski, 2015-07-11)
  *    This is now an internal function
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch;
+ *    use StriContainerUTF16_chunked with a UTF-8 quick check
  */
 SEXP stri_trans_isnf(SEXP str, int type)
 {
     const Normalizer2* normalizer =
         stri__normalizer_get(type); // auto `type` check here, call before ERROR_HANDLER
 
+    STRI__DEDUP_DISPATCH(str, true,
+        stri_trans_isnf(str, type))
     PROTECT(str = stri__prepare_arg_string(str, "str"));    // prepare string argument
     R_len_t str_length = LENGTH(str);
 
     STRI__ERROR_HANDLER_BEGIN(1)
-    StriContainerUTF16 str_cont(str, str_length);
+    StriContainerUTF16_chunked str_cont(str); // a chunk at a time
+    StriNormalizerQuickCheck quick_check(normalizer, type);
 
     SEXP ret;
     STRI__PROTECT(ret = Rf_allocVector(LGLSXP, str_length));
     int* ret_tab = LOGICAL(ret);
 
-    for (R_len_t i = str_cont.vectorize_init();
-            i != str_cont.vectorize_end();
-            i = str_cont.vectorize_next(i))
-    {
-        if (str_cont.isNA(i)) {
-            ret_tab[i] = NA_LOGICAL;
-            continue;
+    while (str_cont.nextChunk(&quick_check)) {
+        int* ret_chunk = ret_tab+str_cont.getChunkStart();
+        for (R_len_t i=0; i<str_cont.get_n(); ++i) {
+            if (str_cont.isNA(i)) {
+                ret_chunk[i] = NA_LOGICAL;
+                continue;
+            }
+
+            if (str_cont.isUnchanged(i)) {  // passed the quick check
+                ret_chunk[i] = TRUE;
+                continue;
+            }
+
+            // C API will not be faster here
+            // as it is a simple wrapper for C++ API
+
+            UErrorCode status = U_ZERO_ERROR;
+            ret_chunk[i] = normalizer->isNormalized(str_cont.get(i), status) ? TRUE : FALSE;
+            STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
         }
-
-        // C API will not be faster here
-        // as it is a simple wrapper for C++ API
-
-        UErrorCode status = U_ZERO_ERROR;
-        ret_tab[i] = normalizer->isNormalized(str_cont.get(i), status) ? TRUE : FALSE;
-        STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
     }
 
     // normalizer shall not be deleted at all
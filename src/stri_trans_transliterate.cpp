@@ -31,7 +31,7 @@
 
 
 #include "stri_stringi.h"
-#include "stri_container_utf16.h"
+#include "stri_container_utf16_chunked.h"
 #include <unicode/translit.h>
 #include <unicode/strenum.h>
 #include <string>
@@ -102,9 +102,16 @@ SEXP stri_trans_list()
  *
  * @version 0.2-2 (Marek Gagolewski, 2014-04-19)
  * @version 1.6.3 (Marek Gagolewski, 2021-06-03)  rules, forward
+ *
+ * @version 1.8.8 (2026-10-16)
+ *    factor-aware dispatch;
+ *    use StriContainerUTF16_chunked (peak memory use);
+ *    reuse the CHARSXPs of the strings left intact
  */
 SEXP stri_trans_general(SEXP str, SEXP id, SEXP rules, SEXP forward)
 {
+    STRI__DEDUP_DISPATCH(str, true,
+        stri_trans_general(str, id, rules, forward))
     PROTECT(str = stri__prepare_arg_string(str, "str"));
     PROTECT(id  = stri__prepare_arg_string_1(id, "id"));
     bool rules_val = stri__prepare_arg_logical_1_notNA(rules, "rules");
@@ -138,11 +145,24 @@ SEXP stri_trans_general(SEXP str, SEXP id, SEXP rules, SEXP forward)
         );
     STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
 
-    StriContainerUTF16 str_cont(str, str_length, false); // writable, no recycle
+    StriContainerUTF16_chunked str_cont(str); // writable, a chunk at a time
 
-    for (R_len_t i=0; i<str_length; ++i) {
-        if (str_cont.isNA(i)) continue;
-        trans->transliterate(str_cont.getWritable(i));
+    SEXP ret;
+    STRI__PROTECT(ret = Rf_allocVector(STRSXP, str_length));
+
+    // Transliterator::getSourceSet() is not reliable for all transforms
+    // (the default implementation returns an empty set), so there is no
+    // quick check here; we compare the outputs with the inputs instead
+    UnicodeString orig;  // buffer reused
+    while (str_cont.nextChunk()) {
+        for (R_len_t i=0; i<str_cont.get_n(); ++i) {
+            if (str_cont.isNA(i)) continue;
+            orig = str_cont.get(i);
+            trans->transliterate(str_cont.getWritable(i));
+            if (str_cont.get(i) == orig)
+                str_cont.setUnchanged(i);
+        }
+        str_cont.toRChunk(ret);
     }
 
     if (trans) {
@@ -150,7 +170,7 @@ SEXP stri_trans_general(SEXP str, SEXP id, SEXP rules, SEXP forward)
         trans = NULL;
     }
     STRI__UNPROTECT_ALL
-    return str_cont.toR();
+    return ret;
     STRI__ERROR_HANDLER_END(
         if (trans) {
             delete trans;